@@ -21,6 +21,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #if defined(TARGET_ANDROID)
 #include <jni.h>
@@ -40,12 +41,39 @@ struct ngl_ctx *ngl_create(void)
     if (!s)
         return NULL;
 
+    s->programcache = ngli_programcache_create();
+    s->shared_buffers = ngli_hmap_create();
+    if (!s->programcache || !s->shared_buffers) {
+        ngli_programcache_freep(&s->programcache);
+        ngli_hmap_freep(&s->shared_buffers);
+        free(s);
+        return NULL;
+    }
+    ngli_hmap_set_free(s->shared_buffers, ngli_geometry_free_shared_buffer, NULL);
+
+    s->params_generation = 1;
+    s->log_ctx.min_level = -1;
+    pthread_mutex_init(&s->deferred_lock, NULL);
+
     LOG(INFO, "Context create in node.gl v%d.%d.%d",
         NODEGL_VERSION_MAJOR, NODEGL_VERSION_MINOR, NODEGL_VERSION_MICRO);
     return s;
 }
 
-int ngl_set_glcontext(struct ngl_ctx *s, void *display, void *window, void *handle, int platform, int api)
+int ngl_set_log_callback(struct ngl_ctx *s, void *arg, ngl_log_callback_type callback)
+{
+    s->log_ctx.user_arg = arg;
+    s->log_ctx.callback = callback;
+    return 0;
+}
+
+int ngl_set_log_min_level(struct ngl_ctx *s, int level)
+{
+    s->log_ctx.min_level = level;
+    return 0;
+}
+
+static int set_glcontext(struct ngl_ctx *s, void *display, void *window, void *handle, int platform, int api)
 {
     s->glcontext = ngli_glcontext_new_wrapped(display, window, handle, platform, api);
     if (!s->glcontext)
@@ -60,11 +88,55 @@ int ngl_set_glcontext(struct ngl_ctx *s, void *display, void *window, void *hand
     if (!s->glstate)
         return -1;
 
+    ngli_glstate_reset_bindings(&s->glbindings);
+
     return 0;
 }
 
-int ngl_set_scene(struct ngl_ctx *s, struct ngl_node *scene)
+static int set_update_threads(struct ngl_ctx *s, int nb_threads)
+{
+    ngli_threadpool_freep(&s->update_pool);
+
+    if (nb_threads <= 1)
+        return 0;
+
+    s->update_pool = ngli_threadpool_create(nb_threads - 1);
+    if (!s->update_pool)
+        return -1;
+
+    LOG(INFO, "update phase running with %d threads", nb_threads);
+    return 0;
+}
+
+static int set_async_prefetch(struct ngl_ctx *s, int enable)
+{
+    if (s->scene) {
+        LOG(ERROR, "asynchronous prefetch can not be changed with a scene set");
+        return -1;
+    }
+
+    ngli_prefetcher_freep(&s->prefetcher);
+
+    if (!enable)
+        return 0;
+
+    if (!s->glcontext) {
+        LOG(ERROR, "asynchronous prefetch requires an OpenGL context");
+        return -1;
+    }
+
+    s->prefetcher = ngli_prefetcher_create(s->glcontext);
+    if (!s->prefetcher)
+        return -1;
+
+    LOG(INFO, "asynchronous prefetch enabled");
+    return 0;
+}
+
+static int set_scene(struct ngl_ctx *s, struct ngl_node *scene)
 {
+    ngli_glstate_reset_bindings(&s->glbindings);
+
     if (s->scene) {
         ngli_node_detach_ctx(s->scene);
         ngl_node_unrefp(&s->scene);
@@ -75,10 +147,17 @@ int ngl_set_scene(struct ngl_ctx *s, struct ngl_node *scene)
         return ret;
 
     s->scene = ngl_node_ref(scene);
+
+    ret = ngli_drawlist_compile(&s->drawlist, s->scene);
+    if (ret < 0) {
+        LOG(ERROR, "unable to compile draw list of scene %s", scene->name);
+        return ret;
+    }
+
     return 0;
 }
 
-int ngl_draw(struct ngl_ctx *s, double t)
+static int draw(struct ngl_ctx *s, double t)
 {
     struct glcontext *glcontext = s->glcontext;
     const struct glfunctions *gl = &glcontext->funcs;
@@ -96,6 +175,11 @@ int ngl_draw(struct ngl_ctx *s, double t)
 
     LOG(DEBUG, "draw scene %s @ t=%f", scene->name, t);
 
+    memset(&glcontext->stats, 0, sizeof(glcontext->stats));
+
+    /* The user may have changed any binding since the last call */
+    ngli_glstate_reset_bindings(&s->glbindings);
+
     ngli_glClear(gl, GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 
     int ret = ngli_node_visit(scene, 1, t);
@@ -110,7 +194,15 @@ int ngl_draw(struct ngl_ctx *s, double t)
     if (ret < 0)
         goto end;
 
-    ngli_node_draw(scene);
+    if (s->drawlist.dirty) {
+        ret = ngli_drawlist_compile(&s->drawlist, scene);
+        if (ret < 0)
+            goto end;
+    }
+
+    ngli_glstate_track_objects(&s->glbindings, 1);
+    ngli_drawlist_replay(&s->drawlist);
+    ngli_glstate_track_objects(&s->glbindings, 0);
 
 end:
     if (ngli_glcontext_check_gl_error(glcontext))
@@ -119,6 +211,128 @@ end:
     return ret;
 }
 
+static int set_program_cache_dir(struct ngl_ctx *s, const char *path)
+{
+    if (s->scene) {
+        LOG(ERROR, "program cache directory can not be changed with a scene set");
+        return -1;
+    }
+
+    int ret = ngli_programcache_set_dir(s->programcache, path);
+    if (ret < 0)
+        return ret;
+
+    if (path)
+        LOG(INFO, "program binaries cached in %s", path);
+    return 0;
+}
+
+static int set_tracing(struct ngl_ctx *s, int nb_events)
+{
+    if (s->scene) {
+        LOG(ERROR, "tracing can not be changed with a scene set");
+        return -1;
+    }
+
+    ngli_tracer_freep(&s->tracer);
+
+    if (nb_events <= 0)
+        return 0;
+
+    s->tracer = ngli_tracer_create(nb_events);
+    if (!s->tracer)
+        return -1;
+
+    return 0;
+}
+
+int ngl_get_frame_stats(struct ngl_ctx *s, struct ngl_frame_stats *stats)
+{
+    if (!s->glcontext)
+        return -1;
+    *stats = s->glcontext->stats;
+    return 0;
+}
+
+static char *dump_trace(struct ngl_ctx *s)
+{
+    if (!s->tracer) {
+        LOG(ERROR, "tracing is not enabled");
+        return NULL;
+    }
+    return ngli_tracer_dump(s->tracer);
+}
+
+/*
+ * The public entry points route the messages logged during their execution to
+ * the settings of the context, so that each rendering thread can have its own.
+ */
+int ngl_set_glcontext(struct ngl_ctx *s, void *display, void *window, void *handle, int platform, int api)
+{
+    const struct log_ctx *prev_log_ctx = ngli_log_set_thread_ctx(&s->log_ctx);
+    int ret = set_glcontext(s, display, window, handle, platform, api);
+    ngli_log_set_thread_ctx(prev_log_ctx);
+    return ret;
+}
+
+int ngl_set_update_threads(struct ngl_ctx *s, int nb_threads)
+{
+    const struct log_ctx *prev_log_ctx = ngli_log_set_thread_ctx(&s->log_ctx);
+    int ret = set_update_threads(s, nb_threads);
+    ngli_log_set_thread_ctx(prev_log_ctx);
+    return ret;
+}
+
+int ngl_set_async_prefetch(struct ngl_ctx *s, int enable)
+{
+    const struct log_ctx *prev_log_ctx = ngli_log_set_thread_ctx(&s->log_ctx);
+    int ret = set_async_prefetch(s, enable);
+    ngli_log_set_thread_ctx(prev_log_ctx);
+    return ret;
+}
+
+int ngl_set_program_cache_dir(struct ngl_ctx *s, const char *path)
+{
+    const struct log_ctx *prev_log_ctx = ngli_log_set_thread_ctx(&s->log_ctx);
+    int ret = set_program_cache_dir(s, path);
+    ngli_log_set_thread_ctx(prev_log_ctx);
+    return ret;
+}
+
+int ngl_set_tracing(struct ngl_ctx *s, int nb_events)
+{
+    const struct log_ctx *prev_log_ctx = ngli_log_set_thread_ctx(&s->log_ctx);
+    int ret = set_tracing(s, nb_events);
+    ngli_log_set_thread_ctx(prev_log_ctx);
+    return ret;
+}
+
+char *ngl_dump_trace(struct ngl_ctx *s)
+{
+    const struct log_ctx *prev_log_ctx = ngli_log_set_thread_ctx(&s->log_ctx);
+    char *ret = dump_trace(s);
+    ngli_log_set_thread_ctx(prev_log_ctx);
+    return ret;
+}
+
+int ngl_set_scene(struct ngl_ctx *s, struct ngl_node *scene)
+{
+    const struct log_ctx *prev_log_ctx = ngli_log_set_thread_ctx(&s->log_ctx);
+    int ret = set_scene(s, scene);
+    ngli_log_set_thread_ctx(prev_log_ctx);
+    return ret;
+}
+
+int ngl_draw(struct ngl_ctx *s, double t)
+{
+    const struct log_ctx *prev_log_ctx = ngli_log_set_thread_ctx(&s->log_ctx);
+    const int64_t trace_start = ngli_trace_start(s->tracer);
+    int ret = draw(s, t);
+    ngli_trace_end(s->tracer, "frame", NULL, "ngl_draw", trace_start);
+    ngli_log_set_thread_ctx(prev_log_ctx);
+    return ret;
+}
+
 void ngl_free(struct ngl_ctx **ss)
 {
     struct ngl_ctx *s = *ss;
@@ -126,12 +340,23 @@ void ngl_free(struct ngl_ctx **ss)
     if (!s)
         return;
 
+    const struct log_ctx *prev_log_ctx = ngli_log_set_thread_ctx(&s->log_ctx);
+    ngli_glstate_reset_bindings(&s->glbindings);
     if (s->scene) {
         ngli_node_detach_ctx(s->scene);
         ngl_node_unrefp(&s->scene);
     }
+    ngli_drawlist_reset(&s->drawlist);
+    ngli_hmap_freep(&s->shared_buffers);
+    ngli_threadpool_freep(&s->update_pool);
+    ngli_prefetcher_freep(&s->prefetcher);
+    ngli_tracer_freep(&s->tracer);
+    free(s->deferred_updates);
+    pthread_mutex_destroy(&s->deferred_lock);
     ngli_glcontext_freep(&s->glcontext);
     ngli_glstate_freep(&s->glstate);
+    ngli_programcache_freep(&s->programcache);
+    ngli_log_set_thread_ctx(prev_log_ctx);
     free(*ss);
     *ss = NULL;
 }
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+#include "utils.h"
+
+struct arena_block {
+    int refcount; /* live allocations + 1 if the block is the arena current one, atomic */
+};
+
+struct arena {
+    size_t block_size;
+    struct arena_block *block;
+    uint8_t *ptr;
+    uint8_t *end;
+};
+
+/* Every allocation is prefixed with a pointer to its block */
+#define HDR_SIZE NGLI_ALIGN
+#define BLK_SIZE NGLI_ALIGN
+#define ALIGN_SIZE(s) (((s) + NGLI_ALIGN - 1) & ~(NGLI_ALIGN - 1))
+
+static struct arena_block *block_create(size_t size)
+{
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, NGLI_ALIGN, BLK_SIZE + size))
+        return NULL;
+    struct arena_block *block = ptr;
+    block->refcount = 1;
+    return block;
+}
+
+static void block_unref(struct arena_block *block)
+{
+    if (__atomic_sub_fetch(&block->refcount, 1, __ATOMIC_ACQ_REL) == 0)
+        free(block);
+}
+
+struct arena *ngli_arena_create(size_t block_size)
+{
+    struct arena *arena = calloc(1, sizeof(*arena));
+    if (!arena)
+        return NULL;
+    arena->block_size = ALIGN_SIZE(block_size);
+    return arena;
+}
+
+static void *block_alloc(struct arena_block *block, uint8_t *ptr, size_t size)
+{
+    memcpy(ptr, &block, sizeof(block));
+    ptr += HDR_SIZE;
+    memset(ptr, 0, size);
+    __atomic_add_fetch(&block->refcount, 1, __ATOMIC_RELAXED);
+    return ptr;
+}
+
+void *ngli_arena_alloc(struct arena *arena, size_t size)
+{
+    const size_t alloc_size = HDR_SIZE + ALIGN_SIZE(size);
+
+    /* Oversized allocations get a dedicated block */
+    if (alloc_size > arena->block_size) {
+        struct arena_block *block = block_create(alloc_size);
+        if (!block)
+            return NULL;
+        void *ptr = block_alloc(block, (uint8_t *)block + BLK_SIZE, size);
+        block_unref(block);
+        return ptr;
+    }
+
+    if (!arena->block || arena->end - arena->ptr < alloc_size) {
+        struct arena_block *block = block_create(arena->block_size);
+        if (!block)
+            return NULL;
+        if (arena->block)
+            block_unref(arena->block);
+        arena->block = block;
+        arena->ptr = (uint8_t *)block + BLK_SIZE;
+        arena->end = arena->ptr + arena->block_size;
+    }
+
+    void *ptr = block_alloc(arena->block, arena->ptr, size);
+    arena->ptr += alloc_size;
+    return ptr;
+}
+
+void ngli_arena_free(void *ptr)
+{
+    if (!ptr)
+        return;
+    struct arena_block *block;
+    memcpy(&block, (uint8_t *)ptr - HDR_SIZE, sizeof(block));
+    block_unref(block);
+}
+
+void ngli_arena_freep(struct arena **arenap)
+{
+    struct arena *arena = *arenap;
+    if (!arena)
+        return;
+    if (arena->block)
+        block_unref(arena->block);
+    free(arena);
+    *arenap = NULL;
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+struct arena;
+
+/*
+ * Allocate objects contiguously into large blocks. Each block keeps track of
+ * its live allocations and is freed along with the last one, so the objects
+ * can still be released individually (and in any order) by their owners.
+ *
+ * All the allocations are aligned on NGLI_ALIGN and zero-initialized.
+ *
+ * ngli_arena_free() can be called from any thread, but a given arena must not
+ * be allocated from concurrently.
+ */
+struct arena *ngli_arena_create(size_t block_size);
+void *ngli_arena_alloc(struct arena *arena, size_t size);
+void ngli_arena_free(void *ptr);
+
+/* Release the arena handle; the blocks remain until all their allocations are freed */
+void ngli_arena_freep(struct arena **arenap);
+
+#endif
@@ -0,0 +1,243 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <cpuid.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <immintrin.h>
+
+#include "math_utils.h"
+
+#define SHUF(v, a, b, c, d) _mm_shuffle_ps(v, v, _MM_SHUFFLE(d, c, b, a))
+
+void ngli_mat4_mul_sse(float *dst, const float *m1, const float *m2)
+{
+    const __m128 c0 = _mm_loadu_ps(m1);
+    const __m128 c1 = _mm_loadu_ps(m1 + 4);
+    const __m128 c2 = _mm_loadu_ps(m1 + 8);
+    const __m128 c3 = _mm_loadu_ps(m1 + 12);
+    __m128 r[4];
+
+    for (int i = 0; i < 4; i++) {
+        const float *v = m2 + i * 4;
+        r[i] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(v[0])),
+                                     _mm_mul_ps(c1, _mm_set1_ps(v[1]))),
+                          _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(v[2])),
+                                     _mm_mul_ps(c3, _mm_set1_ps(v[3]))));
+    }
+
+    _mm_storeu_ps(dst,      r[0]);
+    _mm_storeu_ps(dst + 4,  r[1]);
+    _mm_storeu_ps(dst + 8,  r[2]);
+    _mm_storeu_ps(dst + 12, r[3]);
+}
+
+/* Two columns of m2 are processed at once, one in each 128-bit lane */
+__attribute__((target("avx")))
+void ngli_mat4_mul_avx(float *dst, const float *m1, const float *m2)
+{
+    const __m256 c0 = _mm256_broadcast_ps((const __m128 *)m1);
+    const __m256 c1 = _mm256_broadcast_ps((const __m128 *)(m1 + 4));
+    const __m256 c2 = _mm256_broadcast_ps((const __m128 *)(m1 + 8));
+    const __m256 c3 = _mm256_broadcast_ps((const __m128 *)(m1 + 12));
+    __m256 r[2];
+
+    for (int i = 0; i < 2; i++) {
+        const __m256 v = _mm256_loadu_ps(m2 + i * 8);
+        r[i] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(c0, _mm256_permute_ps(v, 0x00)),
+                                           _mm256_mul_ps(c1, _mm256_permute_ps(v, 0x55))),
+                             _mm256_add_ps(_mm256_mul_ps(c2, _mm256_permute_ps(v, 0xaa)),
+                                           _mm256_mul_ps(c3, _mm256_permute_ps(v, 0xff))));
+    }
+
+    _mm256_storeu_ps(dst,     r[0]);
+    _mm256_storeu_ps(dst + 8, r[1]);
+    _mm256_zeroupper();
+}
+
+void ngli_mat4_mul_vec4_sse(float *dst, const float *m, const float *v)
+{
+    const __m128 x = _mm_loadu_ps(v);
+    const __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(m),      SHUF(x, 0, 0, 0, 0)),
+                                           _mm_mul_ps(_mm_loadu_ps(m + 4),  SHUF(x, 1, 1, 1, 1))),
+                                _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(m + 8),  SHUF(x, 2, 2, 2, 2)),
+                                           _mm_mul_ps(_mm_loadu_ps(m + 12), SHUF(x, 3, 3, 3, 3))));
+    _mm_storeu_ps(dst, r);
+}
+
+static inline __m128 load_vec3(const float *v)
+{
+    return _mm_setr_ps(v[0], v[1], v[2], 0.0f);
+}
+
+static inline __m128 cross3(__m128 a, __m128 b)
+{
+    const __m128 r = _mm_sub_ps(_mm_mul_ps(a, SHUF(b, 1, 2, 0, 3)),
+                                _mm_mul_ps(SHUF(a, 1, 2, 0, 3), b));
+    return SHUF(r, 1, 2, 0, 3);
+}
+
+static inline float dot4(__m128 a, __m128 b)
+{
+    __m128 r = _mm_mul_ps(a, b);
+    r = _mm_add_ps(r, SHUF(r, 2, 3, 0, 1));
+    r = _mm_add_ps(r, SHUF(r, 1, 0, 3, 2));
+    return _mm_cvtss_f32(r);
+}
+
+/*
+ * With a, b and c the columns of m, the rows of the inverse are the cross
+ * products b×c, c×a and a×b divided by the determinant.
+ */
+void ngli_mat3_inverse_sse(float *dst, const float *m)
+{
+    const __m128 a = load_vec3(m);
+    const __m128 b = load_vec3(m + 3);
+    const __m128 c = load_vec3(m + 6);
+
+    __m128 r0 = cross3(b, c);
+    __m128 r1 = cross3(c, a);
+    __m128 r2 = cross3(a, b);
+    __m128 r3 = _mm_setzero_ps();
+
+    const float det = dot4(a, r0);
+    if (det == 0.0f) {
+        memmove(dst, m, 3 * 3 * sizeof(*m));
+        return;
+    }
+
+    const __m128 inv_det = _mm_set1_ps(1.0f / det);
+    r0 = _mm_mul_ps(r0, inv_det);
+    r1 = _mm_mul_ps(r1, inv_det);
+    r2 = _mm_mul_ps(r2, inv_det);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    float tmp[4 * 3];
+    _mm_storeu_ps(tmp,     r0);
+    _mm_storeu_ps(tmp + 4, r1);
+    _mm_storeu_ps(tmp + 8, r2);
+    memcpy(dst,     tmp,     3 * sizeof(*dst));
+    memcpy(dst + 3, tmp + 4, 3 * sizeof(*dst));
+    memcpy(dst + 6, tmp + 8, 3 * sizeof(*dst));
+}
+
+static inline __m128 norm4(__m128 v)
+{
+    const float len2 = dot4(v, v);
+    if (len2 == 0.0f)
+        return v;
+    return _mm_mul_ps(v, _mm_set1_ps(1.0f / sqrtf(len2)));
+}
+
+void ngli_mat4_rotation_from_quat_sse(float *dst, const float *quat)
+{
+    __m128 q = _mm_loadu_ps(quat);
+    if (dot4(q, q) > 1.0f)
+        q = norm4(q);
+    const __m128 q2 = _mm_add_ps(q, q);
+
+    const __m128 v1 = _mm_mul_ps(SHUF(q, 1, 0, 0, 3), SHUF(q2, 1, 1, 2, 3)); /* yy2 xy2 xz2 */
+    const __m128 v2 = _mm_mul_ps(SHUF(q, 2, 3, 3, 3), SHUF(q2, 2, 2, 1, 3)); /* zz2 wz2 wy2 */
+    const __m128 u1 = _mm_mul_ps(SHUF(q, 0, 0, 1, 3), SHUF(q2, 1, 0, 2, 3)); /* xy2 xx2 yz2 */
+    const __m128 u2 = _mm_mul_ps(SHUF(q, 3, 2, 3, 3), SHUF(q2, 2, 2, 0, 3)); /* wz2 zz2 wx2 */
+    const __m128 t1 = _mm_mul_ps(SHUF(q, 0, 1, 0, 3), SHUF(q2, 2, 2, 0, 3)); /* xz2 yz2 xx2 */
+    const __m128 t2 = _mm_mul_ps(SHUF(q, 3, 3, 1, 3), SHUF(q2, 1, 0, 1, 3)); /* wy2 wx2 yy2 */
+
+    const __m128 col0 = _mm_add_ps(_mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f),
+                                   _mm_add_ps(_mm_mul_ps(v1, _mm_setr_ps(-1.0f,  1.0f,  1.0f, 0.0f)),
+                                              _mm_mul_ps(v2, _mm_setr_ps(-1.0f,  1.0f, -1.0f, 0.0f))));
+    const __m128 col1 = _mm_add_ps(_mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f),
+                                   _mm_add_ps(_mm_mul_ps(u1, _mm_setr_ps( 1.0f, -1.0f,  1.0f, 0.0f)),
+                                              _mm_mul_ps(u2, _mm_setr_ps(-1.0f, -1.0f,  1.0f, 0.0f))));
+    const __m128 col2 = _mm_add_ps(_mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f),
+                                   _mm_add_ps(_mm_mul_ps(t1, _mm_setr_ps( 1.0f,  1.0f, -1.0f, 0.0f)),
+                                              _mm_mul_ps(t2, _mm_setr_ps( 1.0f, -1.0f, -1.0f, 0.0f))));
+
+    _mm_storeu_ps(dst,      col0);
+    _mm_storeu_ps(dst + 4,  col1);
+    _mm_storeu_ps(dst + 8,  col2);
+    _mm_storeu_ps(dst + 12, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+#define COS_ALPHA_THRESHOLD 0.9995f
+
+void ngli_quat_slerp_sse(float *dst, const float *q1, const float *q2, float t)
+{
+    __m128 a = _mm_loadu_ps(q1);
+    const __m128 b = _mm_loadu_ps(q2);
+
+    float cos_alpha = dot4(a, b);
+    if (cos_alpha < 0.0f) {
+        cos_alpha = -cos_alpha;
+        a = _mm_sub_ps(_mm_setzero_ps(), a);
+    }
+
+    if (cos_alpha > COS_ALPHA_THRESHOLD) {
+        const __m128 r = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), _mm_set1_ps(t)));
+        _mm_storeu_ps(dst, norm4(r));
+        return;
+    }
+
+    if (cos_alpha > 1.0f)
+        cos_alpha = 1.0f;
+
+    const float alpha = acosf(cos_alpha);
+    const float theta = alpha * t;
+
+    const __m128 c = norm4(_mm_sub_ps(b, _mm_mul_ps(a, _mm_set1_ps(cos_alpha))));
+    const __m128 r = _mm_add_ps(_mm_mul_ps(a, _mm_set1_ps(cos(theta))),
+                                _mm_mul_ps(c, _mm_set1_ps(sin(theta))));
+    _mm_storeu_ps(dst, r);
+}
+
+int ngli_x86_64_has_avx(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return 0;
+
+    if (!(ecx & bit_OSXSAVE) || !(ecx & bit_AVX))
+        return 0;
+
+    /* The OS must also save the YMM registers on context switches */
+    uint32_t xcr0_lo, xcr0_hi;
+    __asm__ volatile ("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+    return (xcr0_lo & 0x6) == 0x6;
+}
+
+void (*ngli_mat4_mul_x86_64)(float *dst, const float *m1, const float *m2) = ngli_mat4_mul_sse;
+void (*ngli_mat4_mul_vec4_x86_64)(float *dst, const float *m, const float *v) = ngli_mat4_mul_vec4_sse;
+void (*ngli_mat3_inverse_x86_64)(float *dst, const float *m) = ngli_mat3_inverse_sse;
+void (*ngli_mat4_rotation_from_quat_x86_64)(float *dst, const float *quat) = ngli_mat4_rotation_from_quat_sse;
+void (*ngli_quat_slerp_x86_64)(float *dst, const float *q1, const float *q2, float t) = ngli_quat_slerp_sse;
+
+/*
+ * SSE2 is part of the x86-64 baseline so the SSE versions are always valid;
+ * the kernels with a faster variant are upgraded at load time.
+ */
+__attribute__((constructor))
+static void init_x86_64_kernels(void)
+{
+    if (ngli_x86_64_has_avx())
+        ngli_mat4_mul_x86_64 = ngli_mat4_mul_avx;
+}
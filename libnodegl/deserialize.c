@@ -28,6 +28,8 @@
 #include "nodes.h"
 #include "params.h"
 
+#define DESERIALIZE_ARENA_BLOCK_SIZE (256 * 1024)
+
 struct serial_ctx {
     struct ngl_node **nodes;
     int nb_nodes;
@@ -406,7 +408,7 @@ static int parse_param(struct serial_ctx *sctx, uint8_t *base_ptr,
 }
 
 static int set_node_params(struct serial_ctx *sctx, char *str,
-                           const struct ngl_node *node)
+                           struct ngl_node *node)
 {
     uint8_t *base_ptr = node->priv_data;
     const struct node_param *params = node->class->params;
@@ -440,6 +442,8 @@ static int set_node_params(struct serial_ctx *sctx, char *str,
         const struct node_param *par = ngli_node_param_find(node, str, &base_ptr);
         if (!par)
             break;
+        if (base_ptr == (uint8_t *)node && ngli_node_unshare_name(node) < 0)
+            break;
 
         str = eok + 1;
         int ret = parse_param(sctx, base_ptr, par, str);
@@ -459,6 +463,7 @@ struct ngl_node *ngl_node_deserialize(const char *str)
 {
     struct ngl_node *node = NULL;
     struct serial_ctx sctx = {0};
+    struct arena *arena = NULL;
 
     char *s = ngli_strdup(str);
     if (!s)
@@ -484,13 +489,18 @@ struct ngl_node *ngl_node_deserialize(const char *str)
     if (*s == '\n')
         s++;
 
+    /* The nodes of the scene are packed together in large blocks */
+    arena = ngli_arena_create(DESERIALIZE_ARENA_BLOCK_SIZE);
+    if (!arena)
+        goto end;
+
     while (s < end - 4) {
         const int type = NGLI_FOURCC(s[0], s[1], s[2], s[3]);
         s += 4;
         if (*s == ' ')
             s++;
 
-        node = ngli_node_create_noconstructor(type);
+        node = ngli_node_create_noconstructor(arena, type);
         if (!node)
             break;
 
@@ -516,6 +526,7 @@ struct ngl_node *ngl_node_deserialize(const char *str)
     free(sctx.nodes);
 
 end:
+    ngli_arena_freep(&arena);
     free(sstart);
     return node;
 }
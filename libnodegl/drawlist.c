@@ -0,0 +1,423 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "drawlist.h"
+#include "hmap.h"
+#include "log.h"
+#include "nodegl.h"
+#include "nodes.h"
+#include "params.h"
+#include "utils.h"
+
+static int add_cmd(struct drawlist *drawlist, int type, struct ngl_node *node)
+{
+    if (drawlist->nb_cmds == drawlist->nb_cmds_allocated) {
+        const int nb_cmds_allocated = drawlist->nb_cmds_allocated ? drawlist->nb_cmds_allocated * 2 : 64;
+        struct drawcmd *cmds = realloc(drawlist->cmds, nb_cmds_allocated * sizeof(*cmds));
+        if (!cmds)
+            return -1;
+        drawlist->cmds = cmds;
+        drawlist->nb_cmds_allocated = nb_cmds_allocated;
+    }
+
+    const int index = drawlist->nb_cmds++;
+    struct drawcmd *cmd = &drawlist->cmds[index];
+    cmd->type = type;
+    cmd->node = node;
+    cmd->next = -1;
+    cmd->first_instance = 0;
+    cmd->nb_instances = 0;
+    return index;
+}
+
+static int add_instance(struct drawlist *drawlist, struct ngl_node *node)
+{
+    if (drawlist->nb_instances == drawlist->nb_instances_allocated) {
+        const int nb_instances_allocated = drawlist->nb_instances_allocated ? drawlist->nb_instances_allocated * 2 : 64;
+        struct ngl_node **instances = realloc(drawlist->instances, nb_instances_allocated * sizeof(*instances));
+        if (!instances)
+            return -1;
+        drawlist->instances = instances;
+        drawlist->nb_instances_allocated = nb_instances_allocated;
+    }
+
+    drawlist->instances[drawlist->nb_instances++] = node;
+    return 0;
+}
+
+/*
+ * A draw unit is the contiguous range of commands of a subtree which can be
+ * moved as a whole when sorting the children of a Group with sort_draws set.
+ */
+struct drawunit {
+    int start;
+    int end;
+    int index;
+    const struct ngl_node *program;
+    const struct hmap *textures;
+    const struct ngl_node *geometry;
+};
+
+struct drawunits {
+    struct drawunit *units;
+    int nb_units;
+    int nb_units_allocated;
+};
+
+static int add_unit(struct drawunits *units, int start, int end)
+{
+    if (start == end)
+        return 0;
+
+    if (units->nb_units == units->nb_units_allocated) {
+        const int nb_units_allocated = units->nb_units_allocated ? units->nb_units_allocated * 2 : 16;
+        struct drawunit *new_units = realloc(units->units, nb_units_allocated * sizeof(*new_units));
+        if (!new_units)
+            return -1;
+        units->units = new_units;
+        units->nb_units_allocated = nb_units_allocated;
+    }
+
+    struct drawunit *unit = &units->units[units->nb_units];
+    memset(unit, 0, sizeof(*unit));
+    unit->start = start;
+    unit->end = end;
+    unit->index = units->nb_units++;
+    return 0;
+}
+
+static int compile_node(struct drawlist *drawlist, struct ngl_node *node);
+
+static int compile_unit(struct drawlist *drawlist, struct ngl_node *node, struct drawunits *units);
+
+static int compile_children(struct drawlist *drawlist, struct ngl_node *node, struct drawunits *units)
+{
+    uint8_t *base_ptr = node->priv_data;
+    const struct node_param *par = node->class->params;
+
+    while (par && par->key) {
+        if (par->flags & PARAM_FLAG_DRAW_CHILD) {
+            if (par->type == PARAM_TYPE_NODE) {
+                struct ngl_node *child = *(struct ngl_node **)(base_ptr + par->offset);
+                if (child) {
+                    int ret = units ? compile_unit(drawlist, child, units)
+                                    : compile_node(drawlist, child);
+                    if (ret < 0)
+                        return ret;
+                }
+            } else if (par->type == PARAM_TYPE_NODELIST) {
+                uint8_t *elems_p = base_ptr + par->offset;
+                uint8_t *nb_elems_p = base_ptr + par->offset + sizeof(struct ngl_node **);
+                struct ngl_node **elems = *(struct ngl_node ***)elems_p;
+                const int nb_elems = *(int *)nb_elems_p;
+                for (int i = 0; i < nb_elems; i++) {
+                    int ret = units ? compile_unit(drawlist, elems[i], units)
+                                    : compile_node(drawlist, elems[i]);
+                    if (ret < 0)
+                        return ret;
+                }
+            }
+        }
+        par++;
+    }
+
+    return 0;
+}
+
+/*
+ * Nodes without any draw callback (transforms, groups with sort_draws set)
+ * have no effect on the GL state, so they are traversed and each of their
+ * drawn descendants becomes an individual unit. The other groups must keep
+ * the order of their children and are moved as a whole.
+ */
+static int compile_unit(struct drawlist *drawlist, struct ngl_node *node, struct drawunits *units)
+{
+    const struct node_class *class = node->class;
+
+    if (class->id == NGL_NODE_GROUP) {
+        const struct group *group = node->priv_data;
+        if (group->sort_draws)
+            return compile_children(drawlist, node, units);
+    } else if (!class->draw && !class->pre_draw && !class->post_draw) {
+        return compile_children(drawlist, node, units);
+    }
+
+    const int start = drawlist->nb_cmds;
+    int ret = compile_node(drawlist, node);
+    if (ret < 0)
+        return ret;
+    return add_unit(units, start, drawlist->nb_cmds);
+}
+
+static int compare_textures(const struct hmap *t0, const struct hmap *t1)
+{
+    if (!t0 || !t1)
+        return (t0 != NULL) - (t1 != NULL);
+
+    const struct hmap_entry *e0 = NULL;
+    const struct hmap_entry *e1 = NULL;
+    for (;;) {
+        e0 = ngli_hmap_next(t0, e0);
+        e1 = ngli_hmap_next(t1, e1);
+        if (!e0 || !e1)
+            return (e0 != NULL) - (e1 != NULL);
+        if (e0->data != e1->data)
+            return (uintptr_t)e0->data < (uintptr_t)e1->data ? -1 : 1;
+    }
+}
+
+/*
+ * Programs are compared by source since identical programs share the same GL
+ * program (and the Render default programs only exist after init)
+ */
+static int compare_programs(const struct ngl_node *p0, const struct ngl_node *p1)
+{
+    if (p0 == p1)
+        return 0;
+    if (!p0 || !p1)
+        return (p0 != NULL) - (p1 != NULL);
+
+    const struct program *s0 = p0->priv_data;
+    const struct program *s1 = p1->priv_data;
+    const int ret = strcmp(s0->vertex, s1->vertex);
+    if (ret)
+        return ret;
+    return strcmp(s0->fragment, s1->fragment);
+}
+
+static int compare_states(const struct drawunit *u0, const struct drawunit *u1)
+{
+    int ret = compare_programs(u0->program, u1->program);
+    if (ret)
+        return ret;
+    ret = compare_textures(u0->textures, u1->textures);
+    if (ret)
+        return ret;
+    return ngli_geometry_compare(u0->geometry, u1->geometry);
+}
+
+static int compare_units(const void *a, const void *b)
+{
+    const struct drawunit *u0 = a;
+    const struct drawunit *u1 = b;
+    const int ret = compare_states(u0, u1);
+    if (ret)
+        return ret;
+
+    /* keep the single draws together so they can be merged into instances */
+    const int single0 = u0->end - u0->start == 1;
+    const int single1 = u1->end - u1->start == 1;
+    if (single0 != single1)
+        return single1 - single0;
+
+    return u0->index - u1->index;
+}
+
+static int is_instanceable(const struct drawlist *drawlist, const struct drawunit *unit)
+{
+    return unit->end - unit->start == 1 &&
+           unit->geometry &&
+           drawlist->cmds[unit->start].type == DRAWCMD_DRAW;
+}
+
+static int sort_units(struct drawlist *drawlist, struct drawunits *units)
+{
+    if (units->nb_units < 2)
+        return 0;
+
+    for (int i = 0; i < units->nb_units; i++) {
+        struct drawunit *unit = &units->units[i];
+        for (int j = unit->start; j < unit->end; j++) {
+            const struct drawcmd *cmd = &drawlist->cmds[j];
+            if (cmd->type == DRAWCMD_DRAW && cmd->node->class->id == NGL_NODE_RENDER) {
+                const struct render *render = cmd->node->priv_data;
+                unit->program  = render->program;
+                unit->textures = render->textures;
+                unit->geometry = render->geometry;
+                break;
+            }
+        }
+    }
+
+    const int start = units->units[0].start;
+    const int end = units->units[units->nb_units - 1].end;
+
+    qsort(units->units, units->nb_units, sizeof(*units->units), compare_units);
+
+    struct drawcmd *cmds = malloc((end - start) * sizeof(*cmds));
+    if (!cmds)
+        return -1;
+
+    int pos = start;
+    for (int i = 0; i < units->nb_units; i++) {
+        const struct drawunit *unit = &units->units[i];
+
+        int nb_instances = 1;
+        if (is_instanceable(drawlist, unit)) {
+            while (i + nb_instances < units->nb_units &&
+                   is_instanceable(drawlist, &units->units[i + nb_instances]) &&
+                   !compare_states(unit, &units->units[i + nb_instances]))
+                nb_instances++;
+        }
+
+        if (nb_instances > 1) {
+            struct drawcmd *cmd = &cmds[pos++ - start];
+            *cmd = drawlist->cmds[unit->start];
+            cmd->type = DRAWCMD_DRAW_INSTANCED;
+            cmd->first_instance = drawlist->nb_instances;
+            cmd->nb_instances = nb_instances;
+            for (int j = 0; j < nb_instances; j++) {
+                const struct drawunit *instance = &units->units[i + j];
+                if (add_instance(drawlist, drawlist->cmds[instance->start].node) < 0) {
+                    free(cmds);
+                    return -1;
+                }
+            }
+            i += nb_instances - 1;
+            continue;
+        }
+
+        const int shift = pos - unit->start;
+        for (int j = unit->start; j < unit->end; j++) {
+            struct drawcmd *cmd = &cmds[pos++ - start];
+            *cmd = drawlist->cmds[j];
+            if (cmd->type == DRAWCMD_PRE_DRAW)
+                cmd->next += shift;
+        }
+    }
+
+    /* the units are always the last compiled commands */
+    ngli_assert(end == drawlist->nb_cmds);
+    memcpy(drawlist->cmds + start, cmds, (pos - start) * sizeof(*cmds));
+    drawlist->nb_cmds = pos;
+    free(cmds);
+
+    return 0;
+}
+
+static int compile_node(struct drawlist *drawlist, struct ngl_node *node)
+{
+    const struct node_class *class = node->class;
+
+    if (class->draw)
+        return add_cmd(drawlist, DRAWCMD_DRAW, node) < 0 ? -1 : 0;
+
+    int pre_draw_index = -1;
+    if (class->pre_draw) {
+        pre_draw_index = add_cmd(drawlist, DRAWCMD_PRE_DRAW, node);
+        if (pre_draw_index < 0)
+            return -1;
+    }
+
+    int ret;
+    if (class->id == NGL_NODE_GROUP && ((struct group *)node->priv_data)->sort_draws) {
+        struct drawunits units = {0};
+        ret = compile_children(drawlist, node, &units);
+        if (ret >= 0) {
+            ret = sort_units(drawlist, &units);
+            LOG(DEBUG, "sorted %d draw units of %s", units.nb_units, node->name);
+        }
+        free(units.units);
+    } else {
+        ret = compile_children(drawlist, node, NULL);
+    }
+    if (ret < 0)
+        return ret;
+
+    if (class->post_draw && add_cmd(drawlist, DRAWCMD_POST_DRAW, node) < 0)
+        return -1;
+
+    if (pre_draw_index >= 0)
+        drawlist->cmds[pre_draw_index].next = drawlist->nb_cmds;
+
+    return 0;
+}
+
+int ngli_drawlist_compile(struct drawlist *drawlist, struct ngl_node *scene)
+{
+    drawlist->nb_cmds = 0;
+    drawlist->nb_instances = 0;
+
+    int ret = compile_node(drawlist, scene);
+    if (ret < 0) {
+        drawlist->nb_cmds = 0;
+        return ret;
+    }
+
+    LOG(DEBUG, "scene %s compiled into %d draw commands", scene->name, drawlist->nb_cmds);
+    drawlist->dirty = 0;
+    return 0;
+}
+
+void ngli_drawlist_replay(const struct drawlist *drawlist)
+{
+    int i = 0;
+
+    while (i < drawlist->nb_cmds) {
+        const struct drawcmd *cmd = &drawlist->cmds[i];
+        struct ngl_node *node = cmd->node;
+
+        switch (cmd->type) {
+        case DRAWCMD_DRAW: {
+            struct tracer *tracer = node->ctx->tracer;
+            const int64_t trace_start = ngli_trace_start(tracer);
+            node->class->draw(node);
+            ngli_trace_end(tracer, "draw", node->name, node->class->name, trace_start);
+            i++;
+            break;
+        }
+        case DRAWCMD_DRAW_INSTANCED: {
+            struct tracer *tracer = node->ctx->tracer;
+            const int64_t trace_start = ngli_trace_start(tracer);
+            ngli_render_draw_instanced(&drawlist->instances[cmd->first_instance], cmd->nb_instances);
+            ngli_trace_end(tracer, "draw", node->name, node->class->name, trace_start);
+            i++;
+            break;
+        }
+        case DRAWCMD_PRE_DRAW:
+            i = node->class->pre_draw(node) ? i + 1 : cmd->next;
+            break;
+        case DRAWCMD_POST_DRAW:
+            node->class->post_draw(node);
+            i++;
+            break;
+        default:
+            ngli_assert(0);
+        }
+    }
+}
+
+void ngli_drawlist_reset(struct drawlist *drawlist)
+{
+    free(drawlist->cmds);
+    drawlist->cmds = NULL;
+    drawlist->nb_cmds = 0;
+    drawlist->nb_cmds_allocated = 0;
+    free(drawlist->instances);
+    drawlist->instances = NULL;
+    drawlist->nb_instances = 0;
+    drawlist->nb_instances_allocated = 0;
+    drawlist->dirty = 1;
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef DRAWLIST_H
+#define DRAWLIST_H
+
+struct ngl_node;
+
+enum {
+    DRAWCMD_DRAW,
+    DRAWCMD_PRE_DRAW,
+    DRAWCMD_POST_DRAW,
+    DRAWCMD_DRAW_INSTANCED,
+};
+
+struct drawcmd {
+    int type;
+    struct ngl_node *node;
+    int next; /* index of the command following the node subtree (PRE_DRAW only) */
+    int first_instance; /* index in the instances array (DRAW_INSTANCED only) */
+    int nb_instances;   /* number of Render nodes to merge (DRAW_INSTANCED only) */
+};
+
+/*
+ * Flat representation of the draw traversal of a scene: the recursive draw
+ * is lowered into a linear array of commands which is replayed every frame.
+ * The list only depends on the graph topology, so it must be rebuilt (using
+ * the dirty flag) every time a drawn child is changed. The draws of the
+ * children of a Group with sort_draws set are sorted by program, textures
+ * and geometry at compile time, so the sorted order is cached as well.
+ * Adjacent Render nodes sharing the same program, textures and geometry
+ * are then merged into a single instanced draw command.
+ */
+struct drawlist {
+    struct drawcmd *cmds;
+    int nb_cmds;
+    int nb_cmds_allocated;
+    struct ngl_node **instances;
+    int nb_instances;
+    int nb_instances_allocated;
+    int dirty;
+};
+
+int ngli_drawlist_compile(struct drawlist *drawlist, struct ngl_node *scene);
+void ngli_drawlist_replay(const struct drawlist *drawlist);
+void ngli_drawlist_reset(struct drawlist *drawlist);
+
+#endif
@@ -45,17 +45,40 @@ cmds_optional = [
 
     #  Buffers
     'glBindBufferBase',
+    'glMapBufferRange',
+    'glUnmapBuffer',
 
     # Compute shaders
     'glDispatchCompute',
 
     # Shaders
+    'glGetProgramInterfaceiv',
     'glGetProgramResourceLocation',
     'glGetProgramResourceIndex',
+    'glGetProgramResourceName',
     'glGetProgramResourceiv',
 
     # Polygon
     'glPolygonMode',
+
+    # Instancing
+    'glDrawElementsInstanced',
+    'glVertexAttribDivisor',
+
+    # Uniform buffers
+    'glGetActiveUniformBlockiv',
+    'glGetActiveUniformsiv',
+    'glGetUniformBlockIndex',
+    'glGetUniformIndices',
+
+    # Program binaries
+    'glGetProgramBinary',
+    'glProgramBinary',
+    'glProgramParameteri',
+
+    # Indirect draws
+    'glDrawElementsIndirect',
+    'glMultiDrawElementsIndirect',
 ]
 
 cmds = [
@@ -66,6 +89,9 @@ cmds = [
     # Error
     'glGetError',
 
+    # Synchronization
+    'glFinish',
+
     # Get
     'glGetBooleanv',
     'glGetIntegeri_v',
@@ -103,6 +129,7 @@ cmds = [
     'glDeleteTextures',
     'glGenTextures',
     'glGenerateMipmap',
+    'glPixelStorei',
     'glTexImage2D',
     'glTexParameteri',
     'glTexSubImage2D',
@@ -151,13 +178,16 @@ cmds = [
     'glUseProgram',
 
     # Shader Attributes
+    'glGetActiveAttrib',
     'glGetAttribLocation',
     'glBindAttribLocation',
     'glEnableVertexAttribArray',
     'glDisableVertexAttribArray',
+    'glVertexAttrib4fv',
     'glVertexAttribPointer',
 
     # Shader Uniforms
+    'glGetActiveUniform',
     'glGetUniformLocation',
     'glUniform1f',
     'glUniform1fv',
@@ -189,6 +219,40 @@ cmds = [
 
 ] + cmds_optional
 
+# Frame statistics counters updated by the wrappers
+uniform_stats = 'gl->stats->nb_uniform_uploads++;'
+cmds_stats = {
+    'glDrawElements':    'gl->stats->nb_draw_calls++;',
+    'glDrawElementsInstanced': 'gl->stats->nb_draw_calls++;',
+    'glDrawElementsIndirect': 'gl->stats->nb_draw_calls++;',
+    'glMultiDrawElementsIndirect': 'gl->stats->nb_draw_calls++;',
+    'glDispatchCompute': 'gl->stats->nb_dispatch_calls++;',
+    'glUseProgram':      'gl->stats->nb_program_switches++;',
+    'glBindTexture':     'gl->stats->nb_texture_binds++;',
+    'glBufferData':      'if (data) {\n' \
+                         '        gl->stats->nb_buffer_uploads++;\n' \
+                         '        gl->stats->buffer_upload_bytes += size;\n' \
+                         '    }',
+    'glBufferSubData':   'gl->stats->nb_buffer_uploads++;\n' \
+                         '    gl->stats->buffer_upload_bytes += size;',
+    'glTexImage2D':      'if (pixels) {\n' \
+                         '        gl->stats->nb_texture_uploads++;\n' \
+                         '        gl->stats->texture_upload_bytes += ngli_gl_image_size(format, type, width, height, 1);\n' \
+                         '    }',
+    'glTexImage3D':      'if (pixels) {\n' \
+                         '        gl->stats->nb_texture_uploads++;\n' \
+                         '        gl->stats->texture_upload_bytes += ngli_gl_image_size(format, type, width, height, depth);\n' \
+                         '    }',
+    'glTexSubImage2D':   'gl->stats->nb_texture_uploads++;\n' \
+                         '    gl->stats->texture_upload_bytes += ngli_gl_image_size(format, type, width, height, 1);',
+    'glTexSubImage3D':   'gl->stats->nb_texture_uploads++;\n' \
+                         '    gl->stats->texture_upload_bytes += ngli_gl_image_size(format, type, width, height, depth);',
+    'glReadPixels':      'gl->stats->readback_bytes += ngli_gl_image_size(format, type, width, height, 1);',
+}
+for cmd in cmds:
+    if cmd.startswith('glUniform'):
+        cmds_stats[cmd] = uniform_stats
+
 def get_proto_elems(xml_node):
     elems = []
     for text in xml_node.itertext():
@@ -207,6 +271,7 @@ def gen(gl_xml):
 #define NGL_GL_H
 
 #include "glfunctions.h"
+#include "nodegl.h"
 
 static const char * const errors_str[] = {
     [GL_INVALID_ENUM]                   = "GL_INVALID_ENUM",
@@ -234,6 +299,38 @@ static inline void check_error_code(const struct glfunctions *gl,
 #else
 # define check_error_code(gl, glfuncname) do { } while (0)
 #endif
+
+static inline int64_t ngli_gl_image_size(GLenum format, GLenum type,
+                                         GLsizei width, GLsizei height, GLsizei depth)
+{
+    int nb_comp;
+    switch (format) {
+    case GL_RED:
+    case GL_RED_INTEGER:
+    case GL_LUMINANCE:
+    case GL_DEPTH_COMPONENT:   nb_comp = 1; break;
+    case GL_RG:
+    case GL_RG_INTEGER:
+    case GL_LUMINANCE_ALPHA:
+    case GL_DEPTH_STENCIL:     nb_comp = 2; break;
+    case GL_RGB:
+    case GL_RGB_INTEGER:       nb_comp = 3; break;
+    default:                   nb_comp = 4; break;
+    }
+
+    int pixel_size;
+    switch (type) {
+    case GL_UNSIGNED_BYTE:
+    case GL_BYTE:              pixel_size = nb_comp;     break;
+    case GL_UNSIGNED_SHORT:
+    case GL_SHORT:
+    case GL_HALF_FLOAT:        pixel_size = nb_comp * 2; break;
+    case GL_UNSIGNED_INT_24_8: pixel_size = 4;           break;
+    default:                   pixel_size = nb_comp * 4; break;
+    }
+
+    return (int64_t)pixel_size * width * height * depth;
+}
 '''
 
     glfunctions = do_not_edit + '''
@@ -242,6 +339,8 @@ static inline void check_error_code(const struct glfunctions *gl,
 
 #include "glincludes.h"
 
+struct ngl_frame_stats;
+
 #ifdef _WIN32
 #define NGLI_GL_APIENTRY WINAPI
 #else
@@ -306,12 +405,16 @@ static const struct gldefinition {
 
         glfunctions   += '    NGLI_GL_APIENTRY %(func_ret)s (*%(func_name_nogl)s)(%(func_args_specs)s);\n' % data
         gldefinitions += '    {"%(func_name)s", offsetof(struct glfunctions, %(func_name_nogl)s), %(flags)s},\n' % data
+        data['stats'] = ''
+        if funcname in cmds_stats:
+            data['stats'] = '    %s\n' % cmds_stats[funcname]
+
         glwrappers    += '''
 static inline %(func_ret)s ngli_%(func_name)s(%(wrapper_args_specs)s)
 {
     %(ret_assign)sgl->%(func_name_nogl)s(%(func_args)s);
     check_error_code(gl, "%(func_name)s");
-%(ret_call)s}
+%(stats)s%(ret_call)s}
 ''' % data
 
         cmds.pop(cmds.index(funcname))
@@ -322,7 +425,7 @@ static inline %(func_ret)s ngli_%(func_name)s(%(wrapper_args_specs)s)
         print('WARNING: function(s) not found: ' + ', '.join(cmds))
 
     glwrappers    += '\n#endif\n'
-    glfunctions   += '};\n\n#endif\n'
+    glfunctions   += '\n    struct ngl_frame_stats *stats;\n};\n\n#endif\n'
     gldefinitions += '};\n'
 
     open('glfunctions.h', 'w').write(glfunctions)
@@ -91,6 +91,7 @@ static struct glcontext *glcontext_new(void *display, void *window, void *handle
 
     glcontext->platform = platform;
     glcontext->api = api;
+    glcontext->funcs.stats = &glcontext->stats;
 
     if (glcontext->class->init) {
         int ret = glcontext->class->init(glcontext, display, window, handle);
@@ -295,7 +296,9 @@ static const struct glfeature {
         .maj_es_version = 3,
         .min_es_version = 1,
         .extensions     = (const char*[]){"GL_ARB_program_interface_query", NULL},
-        .funcs_offsets  = (const size_t[]){OFFSET(GetProgramResourceIndex),
+        .funcs_offsets  = (const size_t[]){OFFSET(GetProgramInterfaceiv),
+                                           OFFSET(GetProgramResourceIndex),
+                                           OFFSET(GetProgramResourceName),
                                            OFFSET(GetProgramResourceiv),
                                            OFFSET(GetProgramResourceLocation),
                                            -1}
@@ -320,6 +323,112 @@ static const struct glfeature {
         .funcs_offsets  = (const size_t[]){OFFSET(TexStorage2D),
                                            OFFSET(TexStorage3D),
                                            -1}
+    }, {
+        .name           = "map_buffer_range",
+        .flag           = NGLI_FEATURE_MAP_BUFFER_RANGE,
+        .maj_version    = 3,
+        .min_version    = 0,
+        .maj_es_version = 3,
+        .min_es_version = 0,
+        .extensions     = (const char*[]){"GL_ARB_map_buffer_range", NULL},
+        .funcs_offsets  = (const size_t[]){OFFSET(MapBufferRange),
+                                           OFFSET(UnmapBuffer),
+                                           -1}
+    }, {
+        .name           = "uniform_buffer_object",
+        .flag           = NGLI_FEATURE_UNIFORM_BUFFER_OBJECT,
+        .maj_version    = 3,
+        .min_version    = 1,
+        .maj_es_version = 3,
+        .min_es_version = 0,
+        .extensions     = (const char*[]){"GL_ARB_uniform_buffer_object", NULL},
+        .funcs_offsets  = (const size_t[]){OFFSET(BindBufferBase),
+                                           OFFSET(GetActiveUniformBlockiv),
+                                           OFFSET(GetActiveUniformsiv),
+                                           OFFSET(GetUniformBlockIndex),
+                                           OFFSET(GetUniformIndices),
+                                           -1}
+    }, {
+        .name           = "instanced_arrays",
+        .flag           = NGLI_FEATURE_INSTANCED_ARRAYS,
+        .maj_version    = 3,
+        .min_version    = 3,
+        .maj_es_version = 3,
+        .min_es_version = 0,
+        .funcs_offsets  = (const size_t[]){OFFSET(DrawElementsInstanced),
+                                           OFFSET(VertexAttribDivisor),
+                                           -1}
+    }, {
+        .name           = "program_binary",
+        .flag           = NGLI_FEATURE_PROGRAM_BINARY,
+        .maj_version    = 4,
+        .min_version    = 1,
+        .maj_es_version = 3,
+        .min_es_version = 0,
+        .extensions     = (const char*[]){"GL_ARB_get_program_binary", NULL},
+        .funcs_offsets  = (const size_t[]){OFFSET(GetProgramBinary),
+                                           OFFSET(ProgramBinary),
+                                           OFFSET(ProgramParameteri),
+                                           -1}
+    }, {
+        .name           = "draw_indirect",
+        .flag           = NGLI_FEATURE_DRAW_INDIRECT,
+        .maj_version    = 4,
+        .min_version    = 0,
+        .maj_es_version = 3,
+        .min_es_version = 1,
+        .extensions     = (const char*[]){"GL_ARB_draw_indirect", NULL},
+        .funcs_offsets  = (const size_t[]){OFFSET(DrawElementsIndirect),
+                                           -1}
+    }, {
+        /* not part of any OpenGL ES version, where the draws are issued
+         * one by one with glDrawElementsIndirect() instead */
+        .name           = "multi_draw_indirect",
+        .flag           = NGLI_FEATURE_MULTI_DRAW_INDIRECT,
+        .maj_version    = 4,
+        .min_version    = 3,
+        .maj_es_version = INT8_MAX,
+        .min_es_version = INT8_MAX,
+        .extensions     = (const char*[]){"GL_ARB_multi_draw_indirect", NULL},
+        .funcs_offsets  = (const size_t[]){OFFSET(MultiDrawElementsIndirect),
+                                           -1}
+    }, {
+        .name           = "pixel_buffer_object",
+        .flag           = NGLI_FEATURE_PIXEL_BUFFER_OBJECT,
+        .maj_version    = 3,
+        .min_version    = 0,
+        .maj_es_version = 3,
+        .min_es_version = 0,
+        .extensions     = (const char*[]){"GL_ARB_pixel_buffer_object", NULL},
+        .es_extensions  = (const char*[]){"GL_NV_pixel_buffer_object", NULL},
+        .funcs_offsets  = (const size_t[]){OFFSET(MapBufferRange),
+                                           OFFSET(UnmapBuffer),
+                                           -1}
+    }, {
+        .name           = "unpack_subimage",
+        .flag           = NGLI_FEATURE_UNPACK_SUBIMAGE,
+        .maj_version    = 2,
+        .min_version    = 0,
+        .maj_es_version = 3,
+        .min_es_version = 0,
+        .es_extensions  = (const char*[]){"GL_EXT_unpack_subimage", NULL},
+    }, {
+        .name           = "element_index_uint",
+        .flag           = NGLI_FEATURE_ELEMENT_INDEX_UINT,
+        .maj_version    = 2,
+        .min_version    = 0,
+        .maj_es_version = 3,
+        .min_es_version = 0,
+        .es_extensions  = (const char*[]){"GL_OES_element_index_uint", NULL},
+    }, {
+        .name           = "vertex_half_float",
+        .flag           = NGLI_FEATURE_VERTEX_HALF_FLOAT,
+        .maj_version    = 3,
+        .min_version    = 0,
+        .maj_es_version = 3,
+        .min_es_version = 0,
+        .extensions     = (const char*[]){"GL_ARB_half_float_vertex", NULL},
+        .es_extensions  = (const char*[]){"GL_OES_vertex_half_float", NULL},
     },
 };
 
@@ -435,6 +544,17 @@ static int glcontext_probe_settings(struct glcontext *glcontext)
 
     ngli_glGetIntegerv(gl, GL_MAX_TEXTURE_IMAGE_UNITS, &glcontext->max_texture_image_units);
 
+    if (glcontext->features & NGLI_FEATURE_UNIFORM_BUFFER_OBJECT)
+        ngli_glGetIntegerv(gl, GL_MAX_UNIFORM_BLOCK_SIZE, &glcontext->max_uniform_block_size);
+
+    /* Some drivers expose the program binary API without any format */
+    if (glcontext->features & NGLI_FEATURE_PROGRAM_BINARY) {
+        GLint nb_binary_formats = 0;
+        ngli_glGetIntegerv(gl, GL_NUM_PROGRAM_BINARY_FORMATS, &nb_binary_formats);
+        if (!nb_binary_formats)
+            glcontext->features &= ~NGLI_FEATURE_PROGRAM_BINARY;
+    }
+
     if (glcontext->features & NGLI_FEATURE_COMPUTE_SHADER) {
         for (int i = 0; i < NGLI_ARRAY_NB(glcontext->max_compute_work_group_counts); i++) {
             ngli_glGetIntegeri_v(gl, GL_MAX_COMPUTE_WORK_GROUP_COUNT,
@@ -32,6 +32,16 @@
 #define NGLI_FEATURE_PROGRAM_INTERFACE_QUERY      (1 << 4)
 #define NGLI_FEATURE_SHADER_IMAGE_LOAD_STORE      (1 << 5)
 #define NGLI_FEATURE_SHADER_STORAGE_BUFFER_OBJECT (1 << 6)
+#define NGLI_FEATURE_MAP_BUFFER_RANGE             (1 << 7)
+#define NGLI_FEATURE_UNIFORM_BUFFER_OBJECT        (1 << 8)
+#define NGLI_FEATURE_INSTANCED_ARRAYS             (1 << 9)
+#define NGLI_FEATURE_PROGRAM_BINARY               (1 << 10)
+#define NGLI_FEATURE_DRAW_INDIRECT                (1 << 11)
+#define NGLI_FEATURE_MULTI_DRAW_INDIRECT          (1 << 12)
+#define NGLI_FEATURE_PIXEL_BUFFER_OBJECT          (1 << 13)
+#define NGLI_FEATURE_UNPACK_SUBIMAGE              (1 << 14)
+#define NGLI_FEATURE_ELEMENT_INDEX_UINT           (1 << 15)
+#define NGLI_FEATURE_VERTEX_HALF_FLOAT            (1 << 16)
 
 #define NGLI_FEATURE_COMPUTE_SHADER_ALL (NGLI_FEATURE_COMPUTE_SHADER           | \
                                          NGLI_FEATURE_PROGRAM_INTERFACE_QUERY  | \
@@ -57,6 +67,7 @@ struct glcontext {
     /* GL features */
     int features;
     int max_texture_image_units;
+    int max_uniform_block_size;
     int max_compute_work_group_counts[3];
 
     GLenum gl_1comp;
@@ -64,6 +75,9 @@ struct glcontext {
 
     /* GL functions */
     struct glfunctions funcs;
+
+    /* Counters updated by the GL wrappers, reset at every frame */
+    struct ngl_frame_stats stats;
 };
 
 struct glcontext_class {
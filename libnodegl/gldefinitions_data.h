@@ -50,8 +50,11 @@ static const struct gldefinition {
     {"glDisableVertexAttribArray", offsetof(struct glfunctions, DisableVertexAttribArray), M},
     {"glDispatchCompute", offsetof(struct glfunctions, DispatchCompute), 0},
     {"glDrawElements", offsetof(struct glfunctions, DrawElements), M},
+    {"glDrawElementsIndirect", offsetof(struct glfunctions, DrawElementsIndirect), 0},
+    {"glDrawElementsInstanced", offsetof(struct glfunctions, DrawElementsInstanced), 0},
     {"glEnable", offsetof(struct glfunctions, Enable), M},
     {"glEnableVertexAttribArray", offsetof(struct glfunctions, EnableVertexAttribArray), M},
+    {"glFinish", offsetof(struct glfunctions, Finish), M},
     {"glFramebufferRenderbuffer", offsetof(struct glfunctions, FramebufferRenderbuffer), M},
     {"glFramebufferTexture2D", offsetof(struct glfunctions, FramebufferTexture2D), M},
     {"glGenBuffers", offsetof(struct glfunctions, GenBuffers), M},
@@ -60,15 +63,22 @@ static const struct gldefinition {
     {"glGenTextures", offsetof(struct glfunctions, GenTextures), M},
     {"glGenVertexArrays", offsetof(struct glfunctions, GenVertexArrays), 0},
     {"glGenerateMipmap", offsetof(struct glfunctions, GenerateMipmap), M},
+    {"glGetActiveAttrib", offsetof(struct glfunctions, GetActiveAttrib), M},
+    {"glGetActiveUniform", offsetof(struct glfunctions, GetActiveUniform), M},
+    {"glGetActiveUniformBlockiv", offsetof(struct glfunctions, GetActiveUniformBlockiv), 0},
+    {"glGetActiveUniformsiv", offsetof(struct glfunctions, GetActiveUniformsiv), 0},
     {"glGetAttachedShaders", offsetof(struct glfunctions, GetAttachedShaders), M},
     {"glGetAttribLocation", offsetof(struct glfunctions, GetAttribLocation), M},
     {"glGetBooleanv", offsetof(struct glfunctions, GetBooleanv), M},
     {"glGetError", offsetof(struct glfunctions, GetError), M},
     {"glGetIntegeri_v", offsetof(struct glfunctions, GetIntegeri_v), M},
     {"glGetIntegerv", offsetof(struct glfunctions, GetIntegerv), M},
+    {"glGetProgramBinary", offsetof(struct glfunctions, GetProgramBinary), 0},
     {"glGetProgramInfoLog", offsetof(struct glfunctions, GetProgramInfoLog), M},
+    {"glGetProgramInterfaceiv", offsetof(struct glfunctions, GetProgramInterfaceiv), 0},
     {"glGetProgramResourceIndex", offsetof(struct glfunctions, GetProgramResourceIndex), 0},
     {"glGetProgramResourceLocation", offsetof(struct glfunctions, GetProgramResourceLocation), 0},
+    {"glGetProgramResourceName", offsetof(struct glfunctions, GetProgramResourceName), 0},
     {"glGetProgramResourceiv", offsetof(struct glfunctions, GetProgramResourceiv), 0},
     {"glGetProgramiv", offsetof(struct glfunctions, GetProgramiv), M},
     {"glGetRenderbufferParameteriv", offsetof(struct glfunctions, GetRenderbufferParameteriv), M},
@@ -77,10 +87,17 @@ static const struct gldefinition {
     {"glGetShaderiv", offsetof(struct glfunctions, GetShaderiv), M},
     {"glGetString", offsetof(struct glfunctions, GetString), M},
     {"glGetStringi", offsetof(struct glfunctions, GetStringi), M},
+    {"glGetUniformBlockIndex", offsetof(struct glfunctions, GetUniformBlockIndex), 0},
+    {"glGetUniformIndices", offsetof(struct glfunctions, GetUniformIndices), 0},
     {"glGetUniformLocation", offsetof(struct glfunctions, GetUniformLocation), M},
     {"glLinkProgram", offsetof(struct glfunctions, LinkProgram), M},
+    {"glMapBufferRange", offsetof(struct glfunctions, MapBufferRange), 0},
     {"glMemoryBarrier", offsetof(struct glfunctions, MemoryBarrier), 0},
+    {"glMultiDrawElementsIndirect", offsetof(struct glfunctions, MultiDrawElementsIndirect), 0},
+    {"glPixelStorei", offsetof(struct glfunctions, PixelStorei), M},
     {"glPolygonMode", offsetof(struct glfunctions, PolygonMode), 0},
+    {"glProgramBinary", offsetof(struct glfunctions, ProgramBinary), 0},
+    {"glProgramParameteri", offsetof(struct glfunctions, ProgramParameteri), 0},
     {"glReadPixels", offsetof(struct glfunctions, ReadPixels), M},
     {"glReleaseShaderCompiler", offsetof(struct glfunctions, ReleaseShaderCompiler), M},
     {"glRenderbufferStorage", offsetof(struct glfunctions, RenderbufferStorage), M},
@@ -118,7 +135,10 @@ static const struct gldefinition {
     {"glUniformMatrix2fv", offsetof(struct glfunctions, UniformMatrix2fv), M},
     {"glUniformMatrix3fv", offsetof(struct glfunctions, UniformMatrix3fv), M},
     {"glUniformMatrix4fv", offsetof(struct glfunctions, UniformMatrix4fv), M},
+    {"glUnmapBuffer", offsetof(struct glfunctions, UnmapBuffer), 0},
     {"glUseProgram", offsetof(struct glfunctions, UseProgram), M},
+    {"glVertexAttrib4fv", offsetof(struct glfunctions, VertexAttrib4fv), M},
+    {"glVertexAttribDivisor", offsetof(struct glfunctions, VertexAttribDivisor), 0},
     {"glVertexAttribPointer", offsetof(struct glfunctions, VertexAttribPointer), M},
     {"glViewport", offsetof(struct glfunctions, Viewport), M},
 };
@@ -5,6 +5,8 @@
 
 #include "glincludes.h"
 
+struct ngl_frame_stats;
+
 #ifdef _WIN32
 #define NGLI_GL_APIENTRY WINAPI
 #else
@@ -51,8 +53,11 @@ struct glfunctions {
     NGLI_GL_APIENTRY void (*DisableVertexAttribArray)(GLuint index);
     NGLI_GL_APIENTRY void (*DispatchCompute)(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z);
     NGLI_GL_APIENTRY void (*DrawElements)(GLenum mode, GLsizei count, GLenum type, const void * indices);
+    NGLI_GL_APIENTRY void (*DrawElementsIndirect)(GLenum mode, GLenum type, const void * indirect);
+    NGLI_GL_APIENTRY void (*DrawElementsInstanced)(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount);
     NGLI_GL_APIENTRY void (*Enable)(GLenum cap);
     NGLI_GL_APIENTRY void (*EnableVertexAttribArray)(GLuint index);
+    NGLI_GL_APIENTRY void (*Finish)();
     NGLI_GL_APIENTRY void (*FramebufferRenderbuffer)(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer);
     NGLI_GL_APIENTRY void (*FramebufferTexture2D)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
     NGLI_GL_APIENTRY void (*GenBuffers)(GLsizei n, GLuint * buffers);
@@ -61,15 +66,22 @@ struct glfunctions {
     NGLI_GL_APIENTRY void (*GenTextures)(GLsizei n, GLuint * textures);
     NGLI_GL_APIENTRY void (*GenVertexArrays)(GLsizei n, GLuint * arrays);
     NGLI_GL_APIENTRY void (*GenerateMipmap)(GLenum target);
+    NGLI_GL_APIENTRY void (*GetActiveAttrib)(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name);
+    NGLI_GL_APIENTRY void (*GetActiveUniform)(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name);
+    NGLI_GL_APIENTRY void (*GetActiveUniformBlockiv)(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint * params);
+    NGLI_GL_APIENTRY void (*GetActiveUniformsiv)(GLuint program, GLsizei uniformCount, const GLuint * uniformIndices, GLenum pname, GLint * params);
     NGLI_GL_APIENTRY void (*GetAttachedShaders)(GLuint program, GLsizei maxCount, GLsizei * count, GLuint * shaders);
     NGLI_GL_APIENTRY GLint (*GetAttribLocation)(GLuint program, const GLchar * name);
     NGLI_GL_APIENTRY void (*GetBooleanv)(GLenum pname, GLboolean * data);
     NGLI_GL_APIENTRY GLenum (*GetError)();
     NGLI_GL_APIENTRY void (*GetIntegeri_v)(GLenum target, GLuint index, GLint * data);
     NGLI_GL_APIENTRY void (*GetIntegerv)(GLenum pname, GLint * data);
+    NGLI_GL_APIENTRY void (*GetProgramBinary)(GLuint program, GLsizei bufSize, GLsizei * length, GLenum * binaryFormat, void * binary);
     NGLI_GL_APIENTRY void (*GetProgramInfoLog)(GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog);
+    NGLI_GL_APIENTRY void (*GetProgramInterfaceiv)(GLuint program, GLenum programInterface, GLenum pname, GLint * params);
     NGLI_GL_APIENTRY GLuint (*GetProgramResourceIndex)(GLuint program, GLenum programInterface, const GLchar * name);
     NGLI_GL_APIENTRY GLint (*GetProgramResourceLocation)(GLuint program, GLenum programInterface, const GLchar * name);
+    NGLI_GL_APIENTRY void (*GetProgramResourceName)(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name);
     NGLI_GL_APIENTRY void (*GetProgramResourceiv)(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum * props, GLsizei bufSize, GLsizei * length, GLint * params);
     NGLI_GL_APIENTRY void (*GetProgramiv)(GLuint program, GLenum pname, GLint * params);
     NGLI_GL_APIENTRY void (*GetRenderbufferParameteriv)(GLenum target, GLenum pname, GLint * params);
@@ -78,10 +90,17 @@ struct glfunctions {
     NGLI_GL_APIENTRY void (*GetShaderiv)(GLuint shader, GLenum pname, GLint * params);
     NGLI_GL_APIENTRY const GLubyte * (*GetString)(GLenum name);
     NGLI_GL_APIENTRY const GLubyte * (*GetStringi)(GLenum name, GLuint index);
+    NGLI_GL_APIENTRY GLuint (*GetUniformBlockIndex)(GLuint program, const GLchar * uniformBlockName);
+    NGLI_GL_APIENTRY void (*GetUniformIndices)(GLuint program, GLsizei uniformCount, const GLchar *const* uniformNames, GLuint * uniformIndices);
     NGLI_GL_APIENTRY GLint (*GetUniformLocation)(GLuint program, const GLchar * name);
     NGLI_GL_APIENTRY void (*LinkProgram)(GLuint program);
+    NGLI_GL_APIENTRY void * (*MapBufferRange)(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
     NGLI_GL_APIENTRY void (*MemoryBarrier)(GLbitfield barriers);
+    NGLI_GL_APIENTRY void (*MultiDrawElementsIndirect)(GLenum mode, GLenum type, const void * indirect, GLsizei drawcount, GLsizei stride);
+    NGLI_GL_APIENTRY void (*PixelStorei)(GLenum pname, GLint param);
     NGLI_GL_APIENTRY void (*PolygonMode)(GLenum face, GLenum mode);
+    NGLI_GL_APIENTRY void (*ProgramBinary)(GLuint program, GLenum binaryFormat, const void * binary, GLsizei length);
+    NGLI_GL_APIENTRY void (*ProgramParameteri)(GLuint program, GLenum pname, GLint value);
     NGLI_GL_APIENTRY void (*ReadPixels)(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void * pixels);
     NGLI_GL_APIENTRY void (*ReleaseShaderCompiler)();
     NGLI_GL_APIENTRY void (*RenderbufferStorage)(GLenum target, GLenum internalformat, GLsizei width, GLsizei height);
@@ -119,9 +138,14 @@ struct glfunctions {
     NGLI_GL_APIENTRY void (*UniformMatrix2fv)(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
     NGLI_GL_APIENTRY void (*UniformMatrix3fv)(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
     NGLI_GL_APIENTRY void (*UniformMatrix4fv)(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
+    NGLI_GL_APIENTRY GLboolean (*UnmapBuffer)(GLenum target);
     NGLI_GL_APIENTRY void (*UseProgram)(GLuint program);
+    NGLI_GL_APIENTRY void (*VertexAttrib4fv)(GLuint index, const GLfloat *v);
+    NGLI_GL_APIENTRY void (*VertexAttribDivisor)(GLuint index, GLuint divisor);
     NGLI_GL_APIENTRY void (*VertexAttribPointer)(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer);
     NGLI_GL_APIENTRY void (*Viewport)(GLint x, GLint y, GLsizei width, GLsizei height);
+
+    struct ngl_frame_stats *stats;
 };
 
 #endif
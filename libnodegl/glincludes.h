@@ -131,6 +131,12 @@
 # define GL_STATIC_COPY                        0x88E6
 # define GL_DYNAMIC_READ                       0x88E9
 # define GL_DYNAMIC_COPY                       0x88EA
+# define GL_PIXEL_PACK_BUFFER                  0x88EB
+# define GL_PIXEL_UNPACK_BUFFER                0x88EC
+# define GL_UNPACK_ROW_LENGTH                  0x0CF2
+# define GL_MAP_READ_BIT                       0x0001
+# define GL_MAP_WRITE_BIT                      0x0002
+# define GL_MAP_INVALIDATE_BUFFER_BIT          0x0008
 # define GL_INVALID_INDEX                      0xFFFFFFFFU
 # define GL_POLYGON_MODE                       0x0B40
 # define GL_FILL                               0x1B02
@@ -152,6 +158,7 @@
 # define GL_SHADER_STORAGE_BUFFER_SIZE         0x90D5
 # define GL_SHADER_STORAGE_BLOCK               0x92E6
 # define GL_BUFFER_BINDING                     0x9302
+# define GL_DRAW_INDIRECT_BUFFER               0x8F3F
 # define GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT    0x00000001
 # define GL_ELEMENT_ARRAY_BARRIER_BIT          0x00000002
 # define GL_UNIFORM_BARRIER_BIT                0x00000004
@@ -167,4 +174,8 @@
 # define GL_ALL_BARRIER_BITS                   0xFFFFFFFF
 #endif
 
+#ifndef GL_HALF_FLOAT_OES
+# define GL_HALF_FLOAT_OES                     0x8D61
+#endif
+
 #endif /* GLINCLUDES_H */
@@ -152,3 +152,159 @@ void ngli_glstate_freep(struct glstate **glstatep)
     free(*glstatep);
     *glstatep = NULL;
 }
+
+static void reset_object_bindings(struct glbindings *bindings)
+{
+    bindings->program              = NGLI_GLBINDING_UNKNOWN;
+    bindings->vertex_array         = NGLI_GLBINDING_UNKNOWN;
+    bindings->array_buffer         = NGLI_GLBINDING_UNKNOWN;
+    bindings->element_array_buffer = NGLI_GLBINDING_UNKNOWN;
+    bindings->active_texture       = NGLI_GLBINDING_UNKNOWN;
+    for (int i = 0; i < NGLI_GLBINDINGS_MAX_TEXTURE_UNITS; i++)
+        for (int j = 0; j < NGLI_GLBINDINGS_NB_TEXTURE_TARGETS; j++)
+            bindings->textures[i][j] = NGLI_GLBINDING_UNKNOWN;
+}
+
+void ngli_glstate_reset_bindings(struct glbindings *bindings)
+{
+    bindings->track_objects = 0;
+    reset_object_bindings(bindings);
+
+    bindings->draw_framebuffer = NGLI_GLBINDING_UNKNOWN;
+    bindings->read_framebuffer = NGLI_GLBINDING_UNKNOWN;
+    bindings->viewport_known   = 0;
+}
+
+void ngli_glstate_track_objects(struct glbindings *bindings, int track)
+{
+    bindings->track_objects = track;
+    reset_object_bindings(bindings);
+}
+
+void ngli_glstate_use_program(const struct glfunctions *gl, struct glbindings *bindings, GLuint program)
+{
+    if (bindings->track_objects) {
+        if (bindings->program == program)
+            return;
+        bindings->program = program;
+    }
+    ngli_glUseProgram(gl, program);
+}
+
+void ngli_glstate_bind_vertex_array(const struct glfunctions *gl, struct glbindings *bindings, GLuint vertex_array)
+{
+    if (bindings->track_objects) {
+        if (bindings->vertex_array == vertex_array)
+            return;
+        bindings->vertex_array = vertex_array;
+        /* the element array buffer binding is part of the vertex array state */
+        bindings->element_array_buffer = NGLI_GLBINDING_UNKNOWN;
+    }
+    ngli_glBindVertexArray(gl, vertex_array);
+}
+
+void ngli_glstate_bind_buffer(const struct glfunctions *gl, struct glbindings *bindings, GLenum target, GLuint buffer)
+{
+    GLuint *binding = NULL;
+    if (bindings->track_objects) {
+        switch (target) {
+        case GL_ARRAY_BUFFER:         binding = &bindings->array_buffer;         break;
+        case GL_ELEMENT_ARRAY_BUFFER: binding = &bindings->element_array_buffer; break;
+        }
+    }
+
+    if (binding) {
+        if (*binding == buffer)
+            return;
+        *binding = buffer;
+    }
+    ngli_glBindBuffer(gl, target, buffer);
+}
+
+void ngli_glstate_active_texture(const struct glfunctions *gl, struct glbindings *bindings, GLenum texture)
+{
+    if (bindings->track_objects) {
+        if (bindings->active_texture == texture)
+            return;
+        bindings->active_texture = texture;
+    }
+    ngli_glActiveTexture(gl, texture);
+}
+
+static int get_texture_target_index(GLenum target)
+{
+    switch (target) {
+    case GL_TEXTURE_2D:             return NGLI_GLBINDINGS_TEXTURE_2D;
+    case GL_TEXTURE_3D:             return NGLI_GLBINDINGS_TEXTURE_3D;
+#ifdef TARGET_ANDROID
+    case GL_TEXTURE_EXTERNAL_OES:   return NGLI_GLBINDINGS_TEXTURE_EXTERNAL_OES;
+#endif
+    }
+    return -1;
+}
+
+void ngli_glstate_bind_texture(const struct glfunctions *gl, struct glbindings *bindings, GLenum target, GLuint texture)
+{
+    GLuint *binding = NULL;
+    if (bindings->track_objects && bindings->active_texture != NGLI_GLBINDING_UNKNOWN) {
+        const int unit = bindings->active_texture - GL_TEXTURE0;
+        const int index = get_texture_target_index(target);
+        if (unit >= 0 && unit < NGLI_GLBINDINGS_MAX_TEXTURE_UNITS && index >= 0)
+            binding = &bindings->textures[unit][index];
+    }
+
+    if (binding) {
+        if (*binding == texture)
+            return;
+        *binding = texture;
+    }
+    ngli_glBindTexture(gl, target, texture);
+}
+
+void ngli_glstate_bind_framebuffer(const struct glfunctions *gl, struct glbindings *bindings, GLenum target, GLuint framebuffer)
+{
+    const int draw = target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER;
+    const int read = target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER;
+
+    if ((!draw || bindings->draw_framebuffer == framebuffer) &&
+        (!read || bindings->read_framebuffer == framebuffer))
+        return;
+
+    if (draw)
+        bindings->draw_framebuffer = framebuffer;
+    if (read)
+        bindings->read_framebuffer = framebuffer;
+    ngli_glBindFramebuffer(gl, target, framebuffer);
+}
+
+GLuint ngli_glstate_get_framebuffer(const struct glfunctions *gl, struct glbindings *bindings, GLenum target)
+{
+    if (target == GL_READ_FRAMEBUFFER) {
+        if (bindings->read_framebuffer == NGLI_GLBINDING_UNKNOWN)
+            ngli_glGetIntegerv(gl, GL_READ_FRAMEBUFFER_BINDING, (GLint *)&bindings->read_framebuffer);
+        return bindings->read_framebuffer;
+    }
+
+    if (bindings->draw_framebuffer == NGLI_GLBINDING_UNKNOWN)
+        ngli_glGetIntegerv(gl, GL_FRAMEBUFFER_BINDING, (GLint *)&bindings->draw_framebuffer);
+    return bindings->draw_framebuffer;
+}
+
+void ngli_glstate_viewport(const struct glfunctions *gl, struct glbindings *bindings, const GLint *viewport)
+{
+    if (bindings->viewport_known && !memcmp(bindings->viewport, viewport, sizeof(bindings->viewport)))
+        return;
+
+    memcpy(bindings->viewport, viewport, sizeof(bindings->viewport));
+    bindings->viewport_known = 1;
+    ngli_glViewport(gl, viewport[0], viewport[1], viewport[2], viewport[3]);
+}
+
+void ngli_glstate_get_viewport(const struct glfunctions *gl, struct glbindings *bindings, GLint *viewport)
+{
+    if (!bindings->viewport_known) {
+        ngli_glGetIntegerv(gl, GL_VIEWPORT, bindings->viewport);
+        bindings->viewport_known = 1;
+    }
+    memcpy(viewport, bindings->viewport, sizeof(bindings->viewport));
+}
@@ -55,4 +55,57 @@ void ngli_glstate_honor_state(const struct glfunctions *gl,
 
 void ngli_glstate_freep(struct glstate **glstatep);
 
+#define NGLI_GLBINDING_UNKNOWN ((GLuint)-1)
+#define NGLI_GLBINDINGS_MAX_TEXTURE_UNITS 32
+
+enum {
+    NGLI_GLBINDINGS_TEXTURE_2D,
+    NGLI_GLBINDINGS_TEXTURE_3D,
+    NGLI_GLBINDINGS_TEXTURE_EXTERNAL_OES,
+    NGLI_GLBINDINGS_NB_TEXTURE_TARGETS
+};
+
+/*
+ * Cache of the object bindings of the rendering context, used to skip
+ * redundant binds.
+ *
+ * The framebuffer and viewport are only ever changed by the nodes through
+ * this cache, so they are always tracked; their initial values are queried
+ * lazily, once per frame at most.
+ *
+ * The program, vertex array, buffer and texture bindings are also modified
+ * outside the draw (uploads, prefetch on the worker context...) so they are
+ * only tracked while track_objects is set, which is the case during the
+ * replay of the draw list. Otherwise, the binds are always issued.
+ */
+struct glbindings {
+    int track_objects;
+
+    GLuint program;
+    GLuint vertex_array;
+    GLuint array_buffer;
+    GLuint element_array_buffer;
+    GLenum active_texture;
+    GLuint textures[NGLI_GLBINDINGS_MAX_TEXTURE_UNITS][NGLI_GLBINDINGS_NB_TEXTURE_TARGETS];
+
+    GLuint draw_framebuffer;
+    GLuint read_framebuffer;
+    GLint viewport[4];
+    int viewport_known;
+};
+
+void ngli_glstate_reset_bindings(struct glbindings *bindings);
+void ngli_glstate_track_objects(struct glbindings *bindings, int track);
+
+void ngli_glstate_use_program(const struct glfunctions *gl, struct glbindings *bindings, GLuint program);
+void ngli_glstate_bind_vertex_array(const struct glfunctions *gl, struct glbindings *bindings, GLuint vertex_array);
+void ngli_glstate_bind_buffer(const struct glfunctions *gl, struct glbindings *bindings, GLenum target, GLuint buffer);
+void ngli_glstate_active_texture(const struct glfunctions *gl, struct glbindings *bindings, GLenum texture);
+void ngli_glstate_bind_texture(const struct glfunctions *gl, struct glbindings *bindings, GLenum target, GLuint texture);
+
+void ngli_glstate_bind_framebuffer(const struct glfunctions *gl, struct glbindings *bindings, GLenum target, GLuint framebuffer);
+GLuint ngli_glstate_get_framebuffer(const struct glfunctions *gl, struct glbindings *bindings, GLenum target);
+void ngli_glstate_viewport(const struct glfunctions *gl, struct glbindings *bindings, const GLint *viewport);
+void ngli_glstate_get_viewport(const struct glfunctions *gl, struct glbindings *bindings, GLint *viewport);
+
 #endif
@@ -4,6 +4,7 @@
 #define NGL_GL_H
 
 #include "glfunctions.h"
+#include "nodegl.h"
 
 static const char * const errors_str[] = {
     [GL_INVALID_ENUM]                   = "GL_INVALID_ENUM",
@@ -32,6 +33,38 @@ static inline void check_error_code(const struct glfunctions *gl,
 # define check_error_code(gl, glfuncname) do { } while (0)
 #endif
 
+static inline int64_t ngli_gl_image_size(GLenum format, GLenum type,
+                                         GLsizei width, GLsizei height, GLsizei depth)
+{
+    int nb_comp;
+    switch (format) {
+    case GL_RED:
+    case GL_RED_INTEGER:
+    case GL_LUMINANCE:
+    case GL_DEPTH_COMPONENT:   nb_comp = 1; break;
+    case GL_RG:
+    case GL_RG_INTEGER:
+    case GL_LUMINANCE_ALPHA:
+    case GL_DEPTH_STENCIL:     nb_comp = 2; break;
+    case GL_RGB:
+    case GL_RGB_INTEGER:       nb_comp = 3; break;
+    default:                   nb_comp = 4; break;
+    }
+
+    int pixel_size;
+    switch (type) {
+    case GL_UNSIGNED_BYTE:
+    case GL_BYTE:              pixel_size = nb_comp;     break;
+    case GL_UNSIGNED_SHORT:
+    case GL_SHORT:
+    case GL_HALF_FLOAT:        pixel_size = nb_comp * 2; break;
+    case GL_UNSIGNED_INT_24_8: pixel_size = 4;           break;
+    default:                   pixel_size = nb_comp * 4; break;
+    }
+
+    return (int64_t)pixel_size * width * height * depth;
+}
+
 static inline void ngli_glActiveTexture(const struct glfunctions *gl, GLenum texture)
 {
     gl->ActiveTexture(texture);
@@ -84,6 +117,7 @@ static inline void ngli_glBindTexture(const struct glfunctions *gl, GLenum targe
 {
     gl->BindTexture(target, texture);
     check_error_code(gl, "glBindTexture");
+    gl->stats->nb_texture_binds++;
 }
 
 static inline void ngli_glBindVertexArray(const struct glfunctions *gl, GLuint array)
@@ -132,12 +166,18 @@ static inline void ngli_glBufferData(const struct glfunctions *gl, GLenum target
 {
     gl->BufferData(target, size, data, usage);
     check_error_code(gl, "glBufferData");
+    if (data) {
+        gl->stats->nb_buffer_uploads++;
+        gl->stats->buffer_upload_bytes += size;
+    }
 }
 
 static inline void ngli_glBufferSubData(const struct glfunctions *gl, GLenum target, GLintptr offset, GLsizeiptr size, const void * data)
 {
     gl->BufferSubData(target, offset, size, data);
     check_error_code(gl, "glBufferSubData");
+    gl->stats->nb_buffer_uploads++;
+    gl->stats->buffer_upload_bytes += size;
 }
 
 static inline GLenum ngli_glCheckFramebufferStatus(const struct glfunctions *gl, GLenum target)
@@ -261,12 +301,28 @@ static inline void ngli_glDispatchCompute(const struct glfunctions *gl, GLuint n
 {
     gl->DispatchCompute(num_groups_x, num_groups_y, num_groups_z);
     check_error_code(gl, "glDispatchCompute");
+    gl->stats->nb_dispatch_calls++;
 }
 
 static inline void ngli_glDrawElements(const struct glfunctions *gl, GLenum mode, GLsizei count, GLenum type, const void * indices)
 {
     gl->DrawElements(mode, count, type, indices);
     check_error_code(gl, "glDrawElements");
+    gl->stats->nb_draw_calls++;
+}
+
+static inline void ngli_glDrawElementsIndirect(const struct glfunctions *gl, GLenum mode, GLenum type, const void * indirect)
+{
+    gl->DrawElementsIndirect(mode, type, indirect);
+    check_error_code(gl, "glDrawElementsIndirect");
+    gl->stats->nb_draw_calls++;
+}
+
+static inline void ngli_glDrawElementsInstanced(const struct glfunctions *gl, GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount)
+{
+    gl->DrawElementsInstanced(mode, count, type, indices, instancecount);
+    check_error_code(gl, "glDrawElementsInstanced");
+    gl->stats->nb_draw_calls++;
 }
 
 static inline void ngli_glEnable(const struct glfunctions *gl, GLenum cap)
@@ -281,6 +337,12 @@ static inline void ngli_glEnableVertexAttribArray(const struct glfunctions *gl,
     check_error_code(gl, "glEnableVertexAttribArray");
 }
 
+static inline void ngli_glFinish(const struct glfunctions *gl)
+{
+    gl->Finish();
+    check_error_code(gl, "glFinish");
+}
+
 static inline void ngli_glFramebufferRenderbuffer(const struct glfunctions *gl, GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
 {
     gl->FramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
@@ -329,6 +391,30 @@ static inline void ngli_glGenerateMipmap(const struct glfunctions *gl, GLenum ta
     check_error_code(gl, "glGenerateMipmap");
 }
 
+static inline void ngli_glGetActiveAttrib(const struct glfunctions *gl, GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name)
+{
+    gl->GetActiveAttrib(program, index, bufSize, length, size, type, name);
+    check_error_code(gl, "glGetActiveAttrib");
+}
+
+static inline void ngli_glGetActiveUniform(const struct glfunctions *gl, GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name)
+{
+    gl->GetActiveUniform(program, index, bufSize, length, size, type, name);
+    check_error_code(gl, "glGetActiveUniform");
+}
+
+static inline void ngli_glGetActiveUniformBlockiv(const struct glfunctions *gl, GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint * params)
+{
+    gl->GetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+    check_error_code(gl, "glGetActiveUniformBlockiv");
+}
+
+static inline void ngli_glGetActiveUniformsiv(const struct glfunctions *gl, GLuint program, GLsizei uniformCount, const GLuint * uniformIndices, GLenum pname, GLint * params)
+{
+    gl->GetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+    check_error_code(gl, "glGetActiveUniformsiv");
+}
+
 static inline void ngli_glGetAttachedShaders(const struct glfunctions *gl, GLuint program, GLsizei maxCount, GLsizei * count, GLuint * shaders)
 {
     gl->GetAttachedShaders(program, maxCount, count, shaders);
@@ -367,12 +453,24 @@ static inline void ngli_glGetIntegerv(const struct glfunctions *gl, GLenum pname
     check_error_code(gl, "glGetIntegerv");
 }
 
+static inline void ngli_glGetProgramBinary(const struct glfunctions *gl, GLuint program, GLsizei bufSize, GLsizei * length, GLenum * binaryFormat, void * binary)
+{
+    gl->GetProgramBinary(program, bufSize, length, binaryFormat, binary);
+    check_error_code(gl, "glGetProgramBinary");
+}
+
 static inline void ngli_glGetProgramInfoLog(const struct glfunctions *gl, GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog)
 {
     gl->GetProgramInfoLog(program, bufSize, length, infoLog);
     check_error_code(gl, "glGetProgramInfoLog");
 }
 
+static inline void ngli_glGetProgramInterfaceiv(const struct glfunctions *gl, GLuint program, GLenum programInterface, GLenum pname, GLint * params)
+{
+    gl->GetProgramInterfaceiv(program, programInterface, pname, params);
+    check_error_code(gl, "glGetProgramInterfaceiv");
+}
+
 static inline GLuint ngli_glGetProgramResourceIndex(const struct glfunctions *gl, GLuint program, GLenum programInterface, const GLchar * name)
 {
     GLuint ret = gl->GetProgramResourceIndex(program, programInterface, name);
@@ -387,6 +485,12 @@ static inline GLint ngli_glGetProgramResourceLocation(const struct glfunctions *
     return ret;
 }
 
+static inline void ngli_glGetProgramResourceName(const struct glfunctions *gl, GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name)
+{
+    gl->GetProgramResourceName(program, programInterface, index, bufSize, length, name);
+    check_error_code(gl, "glGetProgramResourceName");
+}
+
 static inline void ngli_glGetProgramResourceiv(const struct glfunctions *gl, GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum * props, GLsizei bufSize, GLsizei * length, GLint * params)
 {
     gl->GetProgramResourceiv(program, programInterface, index, propCount, props, bufSize, length, params);
@@ -437,6 +541,19 @@ static inline const GLubyte * ngli_glGetStringi(const struct glfunctions *gl, GL
     return ret;
 }
 
+static inline GLuint ngli_glGetUniformBlockIndex(const struct glfunctions *gl, GLuint program, const GLchar * uniformBlockName)
+{
+    GLuint ret = gl->GetUniformBlockIndex(program, uniformBlockName);
+    check_error_code(gl, "glGetUniformBlockIndex");
+    return ret;
+}
+
+static inline void ngli_glGetUniformIndices(const struct glfunctions *gl, GLuint program, GLsizei uniformCount, const GLchar *const* uniformNames, GLuint * uniformIndices)
+{
+    gl->GetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+    check_error_code(gl, "glGetUniformIndices");
+}
+
 static inline GLint ngli_glGetUniformLocation(const struct glfunctions *gl, GLuint program, const GLchar * name)
 {
     GLint ret = gl->GetUniformLocation(program, name);
@@ -450,22 +567,55 @@ static inline void ngli_glLinkProgram(const struct glfunctions *gl, GLuint progr
     check_error_code(gl, "glLinkProgram");
 }
 
+static inline void * ngli_glMapBufferRange(const struct glfunctions *gl, GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    void * ret = gl->MapBufferRange(target, offset, length, access);
+    check_error_code(gl, "glMapBufferRange");
+    return ret;
+}
+
 static inline void ngli_glMemoryBarrier(const struct glfunctions *gl, GLbitfield barriers)
 {
     gl->MemoryBarrier(barriers);
     check_error_code(gl, "glMemoryBarrier");
 }
 
+static inline void ngli_glMultiDrawElementsIndirect(const struct glfunctions *gl, GLenum mode, GLenum type, const void * indirect, GLsizei drawcount, GLsizei stride)
+{
+    gl->MultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+    check_error_code(gl, "glMultiDrawElementsIndirect");
+    gl->stats->nb_draw_calls++;
+}
+
+static inline void ngli_glPixelStorei(const struct glfunctions *gl, GLenum pname, GLint param)
+{
+    gl->PixelStorei(pname, param);
+    check_error_code(gl, "glPixelStorei");
+}
+
 static inline void ngli_glPolygonMode(const struct glfunctions *gl, GLenum face, GLenum mode)
 {
     gl->PolygonMode(face, mode);
     check_error_code(gl, "glPolygonMode");
 }
 
+static inline void ngli_glProgramBinary(const struct glfunctions *gl, GLuint program, GLenum binaryFormat, const void * binary, GLsizei length)
+{
+    gl->ProgramBinary(program, binaryFormat, binary, length);
+    check_error_code(gl, "glProgramBinary");
+}
+
+static inline void ngli_glProgramParameteri(const struct glfunctions *gl, GLuint program, GLenum pname, GLint value)
+{
+    gl->ProgramParameteri(program, pname, value);
+    check_error_code(gl, "glProgramParameteri");
+}
+
 static inline void ngli_glReadPixels(const struct glfunctions *gl, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void * pixels)
 {
     gl->ReadPixels(x, y, width, height, format, type, pixels);
     check_error_code(gl, "glReadPixels");
+    gl->stats->readback_bytes += ngli_gl_image_size(format, type, width, height, 1);
 }
 
 static inline void ngli_glReleaseShaderCompiler(const struct glfunctions *gl)
@@ -532,12 +682,20 @@ static inline void ngli_glTexImage2D(const struct glfunctions *gl, GLenum target
 {
     gl->TexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
     check_error_code(gl, "glTexImage2D");
+    if (pixels) {
+        gl->stats->nb_texture_uploads++;
+        gl->stats->texture_upload_bytes += ngli_gl_image_size(format, type, width, height, 1);
+    }
 }
 
 static inline void ngli_glTexImage3D(const struct glfunctions *gl, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void * pixels)
 {
     gl->TexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
     check_error_code(gl, "glTexImage3D");
+    if (pixels) {
+        gl->stats->nb_texture_uploads++;
+        gl->stats->texture_upload_bytes += ngli_gl_image_size(format, type, width, height, depth);
+    }
 }
 
 static inline void ngli_glTexParameteri(const struct glfunctions *gl, GLenum target, GLenum pname, GLint param)
@@ -562,132 +720,175 @@ static inline void ngli_glTexSubImage2D(const struct glfunctions *gl, GLenum tar
 {
     gl->TexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
     check_error_code(gl, "glTexSubImage2D");
+    gl->stats->nb_texture_uploads++;
+    gl->stats->texture_upload_bytes += ngli_gl_image_size(format, type, width, height, 1);
 }
 
 static inline void ngli_glTexSubImage3D(const struct glfunctions *gl, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels)
 {
     gl->TexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
     check_error_code(gl, "glTexSubImage3D");
+    gl->stats->nb_texture_uploads++;
+    gl->stats->texture_upload_bytes += ngli_gl_image_size(format, type, width, height, depth);
 }
 
 static inline void ngli_glUniform1f(const struct glfunctions *gl, GLint location, GLfloat v0)
 {
     gl->Uniform1f(location, v0);
     check_error_code(gl, "glUniform1f");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniform1fv(const struct glfunctions *gl, GLint location, GLsizei count, const GLfloat * value)
 {
     gl->Uniform1fv(location, count, value);
     check_error_code(gl, "glUniform1fv");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniform1i(const struct glfunctions *gl, GLint location, GLint v0)
 {
     gl->Uniform1i(location, v0);
     check_error_code(gl, "glUniform1i");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniform1iv(const struct glfunctions *gl, GLint location, GLsizei count, const GLint * value)
 {
     gl->Uniform1iv(location, count, value);
     check_error_code(gl, "glUniform1iv");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniform2f(const struct glfunctions *gl, GLint location, GLfloat v0, GLfloat v1)
 {
     gl->Uniform2f(location, v0, v1);
     check_error_code(gl, "glUniform2f");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniform2fv(const struct glfunctions *gl, GLint location, GLsizei count, const GLfloat * value)
 {
     gl->Uniform2fv(location, count, value);
     check_error_code(gl, "glUniform2fv");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniform2i(const struct glfunctions *gl, GLint location, GLint v0, GLint v1)
 {
     gl->Uniform2i(location, v0, v1);
     check_error_code(gl, "glUniform2i");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniform2iv(const struct glfunctions *gl, GLint location, GLsizei count, const GLint * value)
 {
     gl->Uniform2iv(location, count, value);
     check_error_code(gl, "glUniform2iv");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniform3f(const struct glfunctions *gl, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 {
     gl->Uniform3f(location, v0, v1, v2);
     check_error_code(gl, "glUniform3f");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniform3fv(const struct glfunctions *gl, GLint location, GLsizei count, const GLfloat * value)
 {
     gl->Uniform3fv(location, count, value);
     check_error_code(gl, "glUniform3fv");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniform3i(const struct glfunctions *gl, GLint location, GLint v0, GLint v1, GLint v2)
 {
     gl->Uniform3i(location, v0, v1, v2);
     check_error_code(gl, "glUniform3i");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniform3iv(const struct glfunctions *gl, GLint location, GLsizei count, const GLint * value)
 {
     gl->Uniform3iv(location, count, value);
     check_error_code(gl, "glUniform3iv");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniform4f(const struct glfunctions *gl, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
 {
     gl->Uniform4f(location, v0, v1, v2, v3);
     check_error_code(gl, "glUniform4f");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniform4fv(const struct glfunctions *gl, GLint location, GLsizei count, const GLfloat * value)
 {
     gl->Uniform4fv(location, count, value);
     check_error_code(gl, "glUniform4fv");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniform4i(const struct glfunctions *gl, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
 {
     gl->Uniform4i(location, v0, v1, v2, v3);
     check_error_code(gl, "glUniform4i");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniform4iv(const struct glfunctions *gl, GLint location, GLsizei count, const GLint * value)
 {
     gl->Uniform4iv(location, count, value);
     check_error_code(gl, "glUniform4iv");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniformMatrix2fv(const struct glfunctions *gl, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
 {
     gl->UniformMatrix2fv(location, count, transpose, value);
     check_error_code(gl, "glUniformMatrix2fv");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniformMatrix3fv(const struct glfunctions *gl, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
 {
     gl->UniformMatrix3fv(location, count, transpose, value);
     check_error_code(gl, "glUniformMatrix3fv");
+    gl->stats->nb_uniform_uploads++;
 }
 
 static inline void ngli_glUniformMatrix4fv(const struct glfunctions *gl, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
 {
     gl->UniformMatrix4fv(location, count, transpose, value);
     check_error_code(gl, "glUniformMatrix4fv");
+    gl->stats->nb_uniform_uploads++;
+}
+
+static inline GLboolean ngli_glUnmapBuffer(const struct glfunctions *gl, GLenum target)
+{
+    GLboolean ret = gl->UnmapBuffer(target);
+    check_error_code(gl, "glUnmapBuffer");
+    return ret;
 }
 
 static inline void ngli_glUseProgram(const struct glfunctions *gl, GLuint program)
 {
     gl->UseProgram(program);
     check_error_code(gl, "glUseProgram");
+    gl->stats->nb_program_switches++;
+}
+
+static inline void ngli_glVertexAttrib4fv(const struct glfunctions *gl, GLuint index, const GLfloat *v)
+{
+    gl->VertexAttrib4fv(index, v);
+    check_error_code(gl, "glVertexAttrib4fv");
+}
+
+static inline void ngli_glVertexAttribDivisor(const struct glfunctions *gl, GLuint index, GLuint divisor)
+{
+    gl->VertexAttribDivisor(index, divisor);
+    check_error_code(gl, "glVertexAttribDivisor");
 }
 
 static inline void ngli_glVertexAttribPointer(const struct glfunctions *gl, GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer)
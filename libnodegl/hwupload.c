@@ -165,6 +165,27 @@ static int init_common(struct ngl_node *node, struct hwupload_config *config)
     return 0;
 }
 
+static void upload_packed_data(struct ngl_node *node, struct hwupload_config *config, const uint8_t *data)
+{
+    struct ngl_ctx *ctx = node->ctx;
+    struct glcontext *glcontext = ctx->glcontext;
+    struct texture *s = node->priv_data;
+
+    const int linesize = config->linesize >> 2;
+
+    /* Skip the line padding at upload time when the context allows it
+     * instead of uploading it and cropping it with the coordinates matrix */
+    if (glcontext->features & NGLI_FEATURE_UNPACK_SUBIMAGE) {
+        s->coordinates_matrix[0] = 1.0;
+        s->upload_row_length = linesize;
+        ngli_texture_update_local_texture(node, config->width, config->height, 0, data);
+        s->upload_row_length = 0;
+    } else {
+        s->coordinates_matrix[0] = linesize ? config->width / (float)linesize : 1.0;
+        ngli_texture_update_local_texture(node, linesize, config->height, 0, data);
+    }
+}
+
 static int upload_common_frame(struct ngl_node *node, struct hwupload_config *config, struct sxplayer_frame *frame)
 {
     struct texture *s = node->priv_data;
@@ -174,10 +195,8 @@ static int upload_common_frame(struct ngl_node *node, struct hwupload_config *co
     s->format                = config->gl_format;
     s->internal_format       = config->gl_internal_format;
     s->type                  = config->gl_type;
-    const int linesize       = config->linesize >> 2;
-    s->coordinates_matrix[0] = linesize ? config->width / (float)linesize : 1.0;
 
-    ngli_texture_update_local_texture(node, config->linesize >> 2, config->height, 0, frame->data);
+    upload_packed_data(node, config, frame->data);
 
     return 0;
 }
@@ -426,10 +445,8 @@ static int upload_vt_frame(struct ngl_node *node, struct hwupload_config *config
     s->format                = config->gl_format;
     s->internal_format       = config->gl_internal_format;
     s->type                  = config->gl_type;
-    const int linesize       = config->linesize >> 2;
-    s->coordinates_matrix[0] = linesize ? config->width / (float)linesize : 1.0;
 
-    ngli_texture_update_local_texture(node, config->linesize >> 2, config->height, 0, data);
+    upload_packed_data(node, config, data);
 
     CVPixelBufferUnlockBaseAddress(cvpixbuf, kCVPixelBufferLock_ReadOnly);
 
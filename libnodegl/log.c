@@ -19,6 +19,7 @@
  * under the License.
  */
 
+#include <pthread.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -60,35 +61,73 @@ static void default_callback(void *arg, int level, const char *filename, int ln,
            color_end);
 }
 
-static struct {
-    void *user_arg;
-    ngl_log_callback_type callback;
-    int min_level;
-} log_ctx = {
+static struct log_ctx log_ctx = {
     .callback  = default_callback,
     .min_level = NGL_LOG_INFO,
 };
 
+/*
+ * The global settings can be changed while other threads are logging, so the
+ * callback and its argument are always read and written together.
+ */
+static pthread_mutex_t log_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static pthread_key_t thread_log_ctx;
+static pthread_once_t thread_log_ctx_once = PTHREAD_ONCE_INIT;
+
+static void init_thread_log_ctx(void)
+{
+    pthread_key_create(&thread_log_ctx, NULL);
+}
+
 void ngl_log_set_callback(void *arg, ngl_log_callback_type callback)
 {
+    pthread_mutex_lock(&log_lock);
     log_ctx.user_arg = arg;
     log_ctx.callback = callback;
+    pthread_mutex_unlock(&log_lock);
 }
 
 void ngl_log_set_min_level(int level)
 {
-    log_ctx.min_level = level;
+    __atomic_store_n(&log_ctx.min_level, level, __ATOMIC_RELAXED);
+}
+
+const struct log_ctx *ngli_log_set_thread_ctx(const struct log_ctx *ctx)
+{
+    pthread_once(&thread_log_ctx_once, init_thread_log_ctx);
+    const struct log_ctx *prev = pthread_getspecific(thread_log_ctx);
+    pthread_setspecific(thread_log_ctx, ctx);
+    return prev;
 }
 
 void ngli_log_print(int log_level, const char *filename,
                     int ln, const char *fn, const char *fmt, ...)
 {
     va_list arg_list;
+    void *user_arg;
+    ngl_log_callback_type callback;
+    int min_level;
+
+    pthread_once(&thread_log_ctx_once, init_thread_log_ctx);
+    const struct log_ctx *ctx = pthread_getspecific(thread_log_ctx);
 
-    if (log_level < log_ctx.min_level)
+    min_level = ctx && ctx->min_level >= 0 ? ctx->min_level
+                                           : __atomic_load_n(&log_ctx.min_level, __ATOMIC_RELAXED);
+    if (log_level < min_level)
         return;
 
+    if (ctx && ctx->callback) {
+        user_arg = ctx->user_arg;
+        callback = ctx->callback;
+    } else {
+        pthread_mutex_lock(&log_lock);
+        user_arg = log_ctx.user_arg;
+        callback = log_ctx.callback;
+        pthread_mutex_unlock(&log_lock);
+    }
+
     va_start(arg_list, fmt);
-    log_ctx.callback(log_ctx.user_arg, log_level, filename, ln, fn, fmt, arg_list);
+    callback(user_arg, log_level, filename, ln, fn, fmt, arg_list);
     va_end(arg_list);
 }
@@ -25,8 +25,24 @@
 #include "nodegl.h"
 #include "utils.h"
 
+/*
+ * Logging settings; a NULL callback or a negative min_level means the global
+ * ones apply.
+ */
+struct log_ctx {
+    void *user_arg;
+    ngl_log_callback_type callback;
+    int min_level;
+};
+
 #define LOG(log_level, ...) ngli_log_print(NGL_LOG_##log_level, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__)
 
+/*
+ * Route the messages logged by the calling thread to the specified settings
+ * (NULL to restore the global ones). The previous settings are returned.
+ */
+const struct log_ctx *ngli_log_set_thread_ctx(const struct log_ctx *ctx);
+
 void ngli_log_print(int log_level, const char *filename,
                     int ln, const char *fn, const char *fmt, ...) ngli_printf_format(5, 6);
 
@@ -214,7 +214,7 @@ void ngli_mat3_adjugate(float *dst, const float* m)
     memcpy(dst, tmp, sizeof(tmp));
 }
 
-void ngli_mat3_inverse(float *dst, const float *m)
+void ngli_mat3_inverse_c(float *dst, const float *m)
 {
     float a[3*3];
     float det = ngli_mat3_determinant(m);
@@ -336,7 +336,7 @@ void ngli_mat4_perspective(float *dst, float fov, float aspect, float near, floa
     dst[15] =  0;
 }
 
-void ngli_mat4_rotation_from_quat(float *dst, const float *q)
+void ngli_mat4_rotation_from_quat_c(float *dst, const float *q)
 {
     float tmp[4];
     const float *tmpp = q;
@@ -381,7 +381,7 @@ void ngli_mat4_rotation_from_quat(float *dst, const float *q)
 
 #define COS_ALPHA_THRESHOLD 0.9995f
 
-void ngli_quat_slerp(float *dst, const float *q1, const float *q2, float t)
+void ngli_quat_slerp_c(float *dst, const float *q1, const float *q2, float t)
 {
     float tmp_q1[4];
     const float *tmp_q1p = q1;
@@ -47,7 +47,7 @@ void ngli_mat3_mul_scalar(float *dst, const float *m, float s);
 void ngli_mat3_transpose(float *dst, const float *m);
 float ngli_mat3_determinant(const float *m);
 void ngli_mat3_adjugate(float *dst, const float* m);
-void ngli_mat3_inverse(float *dst, const float *m);
+void ngli_mat3_inverse_c(float *dst, const float *m);
 
 #define NGLI_MAT4_IDENTITY {1.0f, 0.0f, 0.0f, 0.0f, \
                             0.0f, 1.0f, 0.0f, 0.0f, \
@@ -59,21 +59,48 @@ void ngli_mat4_mul_c(float *dst, const float *m1, const float *m2);
 void ngli_mat4_mul_vec4_c(float *dst, const float *m, const float *v);
 void ngli_mat4_look_at(float *dst, float *eye, float *center, float *up);
 void ngli_mat4_perspective(float *dst, float fov, float aspect, float near, float far);
-void ngli_mat4_rotation_from_quat(float *dst, const float *quat);
+void ngli_mat4_rotation_from_quat_c(float *dst, const float *quat);
+
+void ngli_quat_slerp_c(float *dst, const float *q1, const float *q2, float t);
 
 /* Arch specific versions */
 
-#ifdef ARCH_AARCH64
-# define ngli_mat4_mul          ngli_mat4_mul_aarch64
-# define ngli_mat4_mul_vec4     ngli_mat4_mul_vec4_aarch64
+#if defined(ARCH_AARCH64)
+# define ngli_mat4_mul                  ngli_mat4_mul_aarch64
+# define ngli_mat4_mul_vec4             ngli_mat4_mul_vec4_aarch64
+# define ngli_mat3_inverse              ngli_mat3_inverse_c
+# define ngli_mat4_rotation_from_quat   ngli_mat4_rotation_from_quat_c
+# define ngli_quat_slerp                ngli_quat_slerp_c
+#elif defined(ARCH_X86_64)
+/* Function pointers selected at load time according to the CPU features */
+# define ngli_mat4_mul                  ngli_mat4_mul_x86_64
+# define ngli_mat4_mul_vec4             ngli_mat4_mul_vec4_x86_64
+# define ngli_mat3_inverse              ngli_mat3_inverse_x86_64
+# define ngli_mat4_rotation_from_quat   ngli_mat4_rotation_from_quat_x86_64
+# define ngli_quat_slerp                ngli_quat_slerp_x86_64
 #else
-# define ngli_mat4_mul          ngli_mat4_mul_c
-# define ngli_mat4_mul_vec4     ngli_mat4_mul_vec4_c
+# define ngli_mat4_mul                  ngli_mat4_mul_c
+# define ngli_mat4_mul_vec4             ngli_mat4_mul_vec4_c
+# define ngli_mat3_inverse              ngli_mat3_inverse_c
+# define ngli_mat4_rotation_from_quat   ngli_mat4_rotation_from_quat_c
+# define ngli_quat_slerp                ngli_quat_slerp_c
 #endif
 
 void ngli_mat4_mul_aarch64(float *dst, const float *m1, const float *m2);
 void ngli_mat4_mul_vec4_aarch64(float *dst, const float *m, const float *v);
 
-void ngli_quat_slerp(float *dst, const float *q1, const float *q2, float t);
+int ngli_x86_64_has_avx(void);
+void ngli_mat4_mul_sse(float *dst, const float *m1, const float *m2);
+void ngli_mat4_mul_avx(float *dst, const float *m1, const float *m2);
+void ngli_mat4_mul_vec4_sse(float *dst, const float *m, const float *v);
+void ngli_mat3_inverse_sse(float *dst, const float *m);
+void ngli_mat4_rotation_from_quat_sse(float *dst, const float *quat);
+void ngli_quat_slerp_sse(float *dst, const float *q1, const float *q2, float t);
+
+extern void (*ngli_mat4_mul_x86_64)(float *dst, const float *m1, const float *m2);
+extern void (*ngli_mat4_mul_vec4_x86_64)(float *dst, const float *m, const float *v);
+extern void (*ngli_mat3_inverse_x86_64)(float *dst, const float *m);
+extern void (*ngli_mat4_rotation_from_quat_x86_64)(float *dst, const float *quat);
+extern void (*ngli_quat_slerp_x86_64)(float *dst, const float *q1, const float *q2, float t);
 
 #endif
@@ -49,6 +49,18 @@ static int get_kf_id(struct ngl_node **animkf, int nb_animkf, int start, double
 
 #define MIX(x, y, a) ((x)*(1.-(a)) + (y)*(a))
 
+static void upload_gl_buffer(struct ngl_node *node)
+{
+    struct ngl_ctx *ctx = node->ctx;
+    struct glcontext *glcontext = ctx->glcontext;
+    const struct glfunctions *gl = &glcontext->funcs;
+    struct buffer *s = node->priv_data;
+
+    ngli_glBindBuffer(gl, GL_ARRAY_BUFFER, s->buffer_id);
+    ngli_glBufferSubData(gl, GL_ARRAY_BUFFER, 0, s->data_size, s->data);
+    ngli_glBindBuffer(gl, GL_ARRAY_BUFFER, 0);
+}
+
 static int animatedbuffer_update(struct ngl_node *node, double t)
 {
     struct buffer *s = node->priv_data;
@@ -83,16 +95,15 @@ static int animatedbuffer_update(struct ngl_node *node, double t)
         memcpy(dst, kf->data, s->data_size);
     }
 
-    struct ngl_ctx *ctx = node->ctx;
-    struct glcontext *glcontext = ctx->glcontext;
-    const struct glfunctions *gl = &glcontext->funcs;
+    if (!s->generate_gl_buffer)
+        return 0;
 
-    if (s->generate_gl_buffer) {
-        ngli_glBindBuffer(gl, GL_ARRAY_BUFFER, s->buffer_id);
-        ngli_glBufferSubData(gl, GL_ARRAY_BUFFER, 0, s->data_size, s->data);
-        ngli_glBindBuffer(gl, GL_ARRAY_BUFFER, 0);
-    }
+    /* The upload requires the GL context which is only available on the
+     * rendering thread */
+    if (node->ctx->parallel_update)
+        return ngli_node_defer_update(node, upload_gl_buffer);
 
+    upload_gl_buffer(node);
     return 0;
 }
 
@@ -172,6 +183,7 @@ static void animatedbuffer_uninit(struct ngl_node *node)
 const struct node_class ngli_animatedbufferfloat_class = {
     .id        = NGL_NODE_ANIMATEDBUFFERFLOAT,
     .name      = "AnimatedBufferFloat",
+    .flags     = NODE_FLAG_TIME_DEPENDENT,
     .init      = animatedbuffer_init,
     .update    = animatedbuffer_update,
     .uninit    = animatedbuffer_uninit,
@@ -183,6 +195,7 @@ const struct node_class ngli_animatedbufferfloat_class = {
 const struct node_class ngli_animatedbuffervec2_class = {
     .id        = NGL_NODE_ANIMATEDBUFFERVEC2,
     .name      = "AnimatedBufferVec2",
+    .flags     = NODE_FLAG_TIME_DEPENDENT,
     .init      = animatedbuffer_init,
     .update    = animatedbuffer_update,
     .uninit    = animatedbuffer_uninit,
@@ -194,6 +207,7 @@ const struct node_class ngli_animatedbuffervec2_class = {
 const struct node_class ngli_animatedbuffervec3_class = {
     .id        = NGL_NODE_ANIMATEDBUFFERVEC3,
     .name      = "AnimatedBufferVec3",
+    .flags     = NODE_FLAG_TIME_DEPENDENT,
     .init      = animatedbuffer_init,
     .update    = animatedbuffer_update,
     .uninit    = animatedbuffer_uninit,
@@ -205,6 +219,7 @@ const struct node_class ngli_animatedbuffervec3_class = {
 const struct node_class ngli_animatedbuffervec4_class = {
     .id        = NGL_NODE_ANIMATEDBUFFERVEC4,
     .name      = "AnimatedBufferVec4",
+    .flags     = NODE_FLAG_TIME_DEPENDENT,
     .init      = animatedbuffer_init,
     .update    = animatedbuffer_update,
     .uninit    = animatedbuffer_uninit,
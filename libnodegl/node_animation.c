@@ -177,6 +177,7 @@ UPDATE_FUNC(quat,   5); /* quaternion (4) + slerp (1) */
 const struct node_class ngli_animatedfloat_class = {
     .id        = NGL_NODE_ANIMATEDFLOAT,
     .name      = "AnimatedFloat",
+    .flags     = NODE_FLAG_TIME_DEPENDENT,
     .init      = animation_init,
     .update    = animatedfloat_update,
     .priv_size = sizeof(struct animation),
@@ -187,6 +188,7 @@ const struct node_class ngli_animatedfloat_class = {
 const struct node_class ngli_animatedvec2_class = {
     .id        = NGL_NODE_ANIMATEDVEC2,
     .name      = "AnimatedVec2",
+    .flags     = NODE_FLAG_TIME_DEPENDENT,
     .init      = animation_init,
     .update    = animatedvec2_update,
     .priv_size = sizeof(struct animation),
@@ -197,6 +199,7 @@ const struct node_class ngli_animatedvec2_class = {
 const struct node_class ngli_animatedvec3_class = {
     .id        = NGL_NODE_ANIMATEDVEC3,
     .name      = "AnimatedVec3",
+    .flags     = NODE_FLAG_TIME_DEPENDENT,
     .init      = animation_init,
     .update    = animatedvec3_update,
     .priv_size = sizeof(struct animation),
@@ -207,6 +210,7 @@ const struct node_class ngli_animatedvec3_class = {
 const struct node_class ngli_animatedvec4_class = {
     .id        = NGL_NODE_ANIMATEDVEC4,
     .name      = "AnimatedVec4",
+    .flags     = NODE_FLAG_TIME_DEPENDENT,
     .init      = animation_init,
     .update    = animatedvec4_update,
     .priv_size = sizeof(struct animation),
@@ -217,6 +221,7 @@ const struct node_class ngli_animatedvec4_class = {
 const struct node_class ngli_animatedquat_class = {
     .id        = NGL_NODE_ANIMATEDQUAT,
     .name      = "AnimatedQuat",
+    .flags     = NODE_FLAG_TIME_DEPENDENT,
     .init      = animation_init,
     .update    = animatedquat_update,
     .priv_size = sizeof(struct animation),
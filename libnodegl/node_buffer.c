@@ -64,6 +64,9 @@ static const struct node_param buffer_params[] = {
                .desc=NGLI_DOCSTRING("filename from which the buffer will be read, cannot be used with `data`")},
     {"stride", PARAM_TYPE_INT,    OFFSET(data_stride),
                .desc=NGLI_DOCSTRING("stride of 1 element, in bytes")},
+    {"normalized", PARAM_TYPE_BOOL, OFFSET(normalized), {.i64=0},
+               .desc=NGLI_DOCSTRING("map the integer values to [0,1] (unsigned) or [-1,1] (signed) "
+                                    "when the buffer is used as a vertex attribute")},
     {"usage",  PARAM_TYPE_SELECT, OFFSET(usage),  {.i64=GL_STATIC_DRAW},
                .desc=NGLI_DOCSTRING("buffer usage hint"),
                .choices=&usage_choices},
@@ -190,6 +193,10 @@ static int buffer_init(struct ngl_node *node)
     case NGL_NODE_BUFFERUSVEC2: data_comp_size = 2; nb_comp = 2; comp_type = GL_UNSIGNED_SHORT;    break;
     case NGL_NODE_BUFFERUSVEC3: data_comp_size = 2; nb_comp = 3; comp_type = GL_UNSIGNED_SHORT;    break;
     case NGL_NODE_BUFFERUSVEC4: data_comp_size = 2; nb_comp = 4; comp_type = GL_UNSIGNED_SHORT;    break;
+    case NGL_NODE_BUFFERHALFFLOAT: data_comp_size = 2; nb_comp = 1; comp_type = GL_HALF_FLOAT;     break;
+    case NGL_NODE_BUFFERHVEC2:  data_comp_size = 2; nb_comp = 2; comp_type = GL_HALF_FLOAT;        break;
+    case NGL_NODE_BUFFERHVEC3:  data_comp_size = 2; nb_comp = 3; comp_type = GL_HALF_FLOAT;        break;
+    case NGL_NODE_BUFFERHVEC4:  data_comp_size = 2; nb_comp = 4; comp_type = GL_HALF_FLOAT;        break;
     case NGL_NODE_BUFFERFLOAT:  data_comp_size = 4; nb_comp = 1; comp_type = GL_FLOAT;             break;
     case NGL_NODE_BUFFERVEC2:   data_comp_size = 4; nb_comp = 2; comp_type = GL_FLOAT;             break;
     case NGL_NODE_BUFFERVEC3:   data_comp_size = 4; nb_comp = 3; comp_type = GL_FLOAT;             break;
@@ -198,6 +205,11 @@ static int buffer_init(struct ngl_node *node)
         ngli_assert(0);
     }
 
+    /* OpenGL ES 2.0 only supports half floats vertex attributes through
+     * the OES_vertex_half_float extension, with a different enum */
+    if (comp_type == GL_HALF_FLOAT && glcontext->es && glcontext->major_version < 3)
+        comp_type = GL_HALF_FLOAT_OES;
+
     s->data_comp = nb_comp;
     s->data_comp_type = comp_type;
 
@@ -277,6 +289,10 @@ DEFINE_BUFFER_CLASS(NGL_NODE_BUFFERUSHORT,  "BufferUShort",  ushort)
 DEFINE_BUFFER_CLASS(NGL_NODE_BUFFERUSVEC2,  "BufferUSVec2",  usvec2)
 DEFINE_BUFFER_CLASS(NGL_NODE_BUFFERUSVEC3,  "BufferUSVec3",  usvec3)
 DEFINE_BUFFER_CLASS(NGL_NODE_BUFFERUSVEC4,  "BufferUSVec4",  usvec4)
+DEFINE_BUFFER_CLASS(NGL_NODE_BUFFERHALFFLOAT, "BufferHalfFloat", halffloat)
+DEFINE_BUFFER_CLASS(NGL_NODE_BUFFERHVEC2,   "BufferHVec2",   hvec2)
+DEFINE_BUFFER_CLASS(NGL_NODE_BUFFERHVEC3,   "BufferHVec3",   hvec3)
+DEFINE_BUFFER_CLASS(NGL_NODE_BUFFERHVEC4,   "BufferHVec4",   hvec4)
 DEFINE_BUFFER_CLASS(NGL_NODE_BUFFERFLOAT,   "BufferFloat",   float)
 DEFINE_BUFFER_CLASS(NGL_NODE_BUFFERVEC2,    "BufferVec2",    vec2)
 DEFINE_BUFFER_CLASS(NGL_NODE_BUFFERVEC3,    "BufferVec3",    vec3)
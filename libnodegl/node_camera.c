@@ -33,7 +33,7 @@
 
 #define OFFSET(x) offsetof(struct camera, x)
 static const struct node_param camera_params[] = {
-    {"child", PARAM_TYPE_NODE, OFFSET(child), .flags=PARAM_FLAG_CONSTRUCTOR,
+    {"child", PARAM_TYPE_NODE, OFFSET(child), .flags=PARAM_FLAG_CONSTRUCTOR|PARAM_FLAG_DRAW_CHILD,
               .desc=NGLI_DOCSTRING("scene to observe through the lens of the camera")},
     {"eye", PARAM_TYPE_VEC3,  OFFSET(eye), {.vec={0.0f, 0.0f, 0.0f}},
             .desc=NGLI_DOCSTRING("eye position")},
@@ -82,15 +82,15 @@ static int camera_init(struct ngl_node *node)
     }
 
     if (s->pipe_fd) {
+        struct ngl_ctx *ctx = node->ctx;
+        struct glcontext *glcontext = ctx->glcontext;
+        const struct glfunctions *gl = &glcontext->funcs;
+
         s->pipe_buf = calloc(4 /* RGBA */, s->pipe_width * s->pipe_height);
         if (!s->pipe_buf)
             return -1;
 
 #if defined(TARGET_DARWIN) || defined(TARGET_LINUX)
-        struct ngl_ctx *ctx = node->ctx;
-        struct glcontext *glcontext = ctx->glcontext;
-        const struct glfunctions *gl = &glcontext->funcs;
-
         ngli_glGenTextures(gl, 1, &s->texture_id);
         ngli_glBindTexture(gl, GL_TEXTURE_2D, s->texture_id);
         ngli_glTexParameteri(gl, GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -100,16 +100,31 @@ static int camera_init(struct ngl_node *node)
         ngli_glTexImage2D(gl, GL_TEXTURE_2D, 0, GL_RGBA, s->pipe_width, s->pipe_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
         ngli_glBindTexture(gl, GL_TEXTURE_2D, 0);
 
-        GLuint framebuffer_id;
-        ngli_glGetIntegerv(gl, GL_FRAMEBUFFER_BINDING, (GLint *)&framebuffer_id);
+        struct glbindings *bindings = &ctx->glbindings;
+        const GLuint framebuffer_id = ngli_glstate_get_framebuffer(gl, bindings, GL_FRAMEBUFFER);
 
         ngli_glGenFramebuffers(gl, 1, &s->framebuffer_id);
-        ngli_glBindFramebuffer(gl, GL_FRAMEBUFFER, s->framebuffer_id);
+        ngli_glstate_bind_framebuffer(gl, bindings, GL_FRAMEBUFFER, s->framebuffer_id);
         ngli_glFramebufferTexture2D(gl, GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, s->texture_id, 0);
         ngli_assert(ngli_glCheckFramebufferStatus(gl, GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
 
-        ngli_glBindFramebuffer(gl, GL_FRAMEBUFFER, framebuffer_id);
+        ngli_glstate_bind_framebuffer(gl, bindings, GL_FRAMEBUFFER, framebuffer_id);
 #endif
+
+        /*
+         * When available, the frames are read back asynchronously through a
+         * pair of pixel buffers: the readback of a frame is only waited for
+         * after the next one has been submitted, which lets the update of the
+         * next frame overlap with the rendering of the current one.
+         */
+        if (glcontext->features & NGLI_FEATURE_MAP_BUFFER_RANGE) {
+            ngli_glGenBuffers(gl, NGLI_ARRAY_NB(s->pbo_ids), s->pbo_ids);
+            for (int i = 0; i < NGLI_ARRAY_NB(s->pbo_ids); i++) {
+                ngli_glBindBuffer(gl, GL_PIXEL_PACK_BUFFER, s->pbo_ids[i]);
+                ngli_glBufferData(gl, GL_PIXEL_PACK_BUFFER, s->pipe_width * s->pipe_height * 4, NULL, GL_STREAM_READ);
+            }
+            ngli_glBindBuffer(gl, GL_PIXEL_PACK_BUFFER, 0);
+        }
     }
 
     return 0;
@@ -184,43 +199,77 @@ static int camera_update(struct ngl_node *node, double t)
     return ngli_node_update(child, t);
 }
 
-static void camera_draw(struct ngl_node *node)
+static void write_pbo(struct ngl_node *node, GLuint pbo_id)
+{
+    struct ngl_ctx *ctx = node->ctx;
+    struct glcontext *glcontext = ctx->glcontext;
+    const struct glfunctions *gl = &glcontext->funcs;
+
+    struct camera *s = node->priv_data;
+    const int size = s->pipe_width * s->pipe_height * 4;
+
+    ngli_glBindBuffer(gl, GL_PIXEL_PACK_BUFFER, pbo_id);
+    const void *data = ngli_glMapBufferRange(gl, GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+    if (data) {
+        LOG(DEBUG, "write %dx%d buffer to FD=%d", s->pipe_width, s->pipe_height, s->pipe_fd);
+        write(s->pipe_fd, data, size);
+        ngli_glUnmapBuffer(gl, GL_PIXEL_PACK_BUFFER);
+    } else {
+        LOG(ERROR, "unable to map pixel buffer %u", pbo_id);
+    }
+    ngli_glBindBuffer(gl, GL_PIXEL_PACK_BUFFER, 0);
+}
+
+static void camera_post_draw(struct ngl_node *node)
 {
     struct ngl_ctx *ctx = node->ctx;
     struct glcontext *glcontext = ctx->glcontext;
     const struct glfunctions *gl = &glcontext->funcs;
 
     struct camera *s = node->priv_data;
-    ngli_node_draw(s->child);
 
     if (s->pipe_fd) {
 #if defined(TARGET_DARWIN) || defined(TARGET_LINUX)
+        struct glbindings *bindings = &ctx->glbindings;
         GLint multisampling = 0;
-        GLuint framebuffer_read_id;
-        GLuint framebuffer_draw_id;
+        GLuint framebuffer_read_id = 0;
+        GLuint framebuffer_draw_id = 0;
 
         ngli_glGetIntegerv(gl, GL_MULTISAMPLE, &multisampling);
 
         if (multisampling) {
-            ngli_glGetIntegerv(gl, GL_READ_FRAMEBUFFER_BINDING, (GLint *)&framebuffer_read_id);
-            ngli_glGetIntegerv(gl, GL_DRAW_FRAMEBUFFER_BINDING, (GLint *)&framebuffer_draw_id);
+            framebuffer_read_id = ngli_glstate_get_framebuffer(gl, bindings, GL_READ_FRAMEBUFFER);
+            framebuffer_draw_id = ngli_glstate_get_framebuffer(gl, bindings, GL_DRAW_FRAMEBUFFER);
 
-            ngli_glBindFramebuffer(gl, GL_READ_FRAMEBUFFER, framebuffer_draw_id);
-            ngli_glBindFramebuffer(gl, GL_DRAW_FRAMEBUFFER, s->framebuffer_id);
+            ngli_glstate_bind_framebuffer(gl, bindings, GL_READ_FRAMEBUFFER, framebuffer_draw_id);
+            ngli_glstate_bind_framebuffer(gl, bindings, GL_DRAW_FRAMEBUFFER, s->framebuffer_id);
             ngli_glBlitFramebuffer(gl, 0, 0, s->pipe_width, s->pipe_height, 0, 0, s->pipe_width, s->pipe_height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
 
-            ngli_glBindFramebuffer(gl, GL_READ_FRAMEBUFFER, s->framebuffer_id);
+            ngli_glstate_bind_framebuffer(gl, bindings, GL_READ_FRAMEBUFFER, s->framebuffer_id);
         }
 #endif
 
-        LOG(DEBUG, "write %dx%d buffer to FD=%d", s->pipe_width, s->pipe_height, s->pipe_fd);
-        ngli_glReadPixels(gl, 0, 0, s->pipe_width, s->pipe_height, GL_RGBA, GL_UNSIGNED_BYTE, s->pipe_buf);
-        write(s->pipe_fd, s->pipe_buf, s->pipe_width * s->pipe_height * 4);
+        if (s->pbo_ids[0]) {
+            const int index = s->pbo_index;
+
+            ngli_glBindBuffer(gl, GL_PIXEL_PACK_BUFFER, s->pbo_ids[index]);
+            ngli_glReadPixels(gl, 0, 0, s->pipe_width, s->pipe_height, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+            ngli_glBindBuffer(gl, GL_PIXEL_PACK_BUFFER, 0);
+
+            if (s->pbo_pending)
+                write_pbo(node, s->pbo_ids[index ^ 1]);
+            s->pbo_pending = 1;
+            s->pbo_index = index ^ 1;
+        } else {
+            LOG(DEBUG, "write %dx%d buffer to FD=%d", s->pipe_width, s->pipe_height, s->pipe_fd);
+            ngli_glReadPixels(gl, 0, 0, s->pipe_width, s->pipe_height, GL_RGBA, GL_UNSIGNED_BYTE, s->pipe_buf);
+            write(s->pipe_fd, s->pipe_buf, s->pipe_width * s->pipe_height * 4);
+        }
 
 #if defined(TARGET_DARWIN) || defined(TARGET_LINUX)
         if (multisampling) {
-            ngli_glBindFramebuffer(gl, GL_READ_FRAMEBUFFER, framebuffer_read_id);
-            ngli_glBindFramebuffer(gl, GL_DRAW_FRAMEBUFFER, framebuffer_draw_id);
+            ngli_glstate_bind_framebuffer(gl, bindings, GL_READ_FRAMEBUFFER, framebuffer_read_id);
+            ngli_glstate_bind_framebuffer(gl, bindings, GL_DRAW_FRAMEBUFFER, framebuffer_draw_id);
         }
 #endif
     }
@@ -231,14 +280,21 @@ static void camera_uninit(struct ngl_node *node)
 {
     struct camera *s = node->priv_data;
     if (s->pipe_fd) {
-        free(s->pipe_buf);
-
-#if defined(TARGET_DARWIN) || defined(TARGET_LINUX)
         struct ngl_ctx *ctx = node->ctx;
         struct glcontext *glcontext = ctx->glcontext;
         const struct glfunctions *gl = &glcontext->funcs;
 
-        ngli_glBindFramebuffer(gl, GL_FRAMEBUFFER, s->framebuffer_id);
+        free(s->pipe_buf);
+
+        if (s->pbo_ids[0]) {
+            /* Flush the last frame still in flight */
+            if (s->pbo_pending)
+                write_pbo(node, s->pbo_ids[s->pbo_index ^ 1]);
+            ngli_glDeleteBuffers(gl, NGLI_ARRAY_NB(s->pbo_ids), s->pbo_ids);
+        }
+
+#if defined(TARGET_DARWIN) || defined(TARGET_LINUX)
+        ngli_glstate_bind_framebuffer(gl, &ctx->glbindings, GL_FRAMEBUFFER, s->framebuffer_id);
         ngli_glFramebufferTexture2D(gl, GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
 
         ngli_glDeleteRenderbuffers(gl, 1, &s->framebuffer_id);
@@ -252,7 +308,7 @@ const struct node_class ngli_camera_class = {
     .name      = "Camera",
     .init      = camera_init,
     .update    = camera_update,
-    .draw      = camera_draw,
+    .post_draw = camera_post_draw,
     .uninit    = camera_uninit,
     .priv_size = sizeof(struct camera),
     .params    = camera_params,
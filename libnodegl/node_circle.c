@@ -30,9 +30,9 @@
 
 #define OFFSET(x) offsetof(struct geometry, x)
 static const struct node_param circle_params[] = {
-    {"radius",  PARAM_TYPE_DBL, OFFSET(radius),  {.dbl=1.0},
+    {"radius",  PARAM_TYPE_DBL, OFFSET(radius),  {.dbl=1.0}, .flags=PARAM_FLAG_DRAW_ORDER,
                 .desc=NGLI_DOCSTRING("circle radius")},
-    {"npoints", PARAM_TYPE_INT, OFFSET(npoints), {.i64=16},
+    {"npoints", PARAM_TYPE_INT, OFFSET(npoints), {.i64=16}, .flags=PARAM_FLAG_DRAW_ORDER,
                 .desc=NGLI_DOCSTRING("number of points")},
     {NULL}
 };
@@ -80,32 +80,34 @@ static int circle_init(struct ngl_node *node)
     for (int i = 1; i < nb_vertices; i++)
         memcpy(normals + (i * 3), normals, 3 * sizeof(*normals));
 
-    s->vertices_buffer = ngli_geometry_generate_buffer(node->ctx,
-                                                       NGL_NODE_BUFFERVEC3,
-                                                       nb_vertices,
-                                                       nb_vertices * sizeof(*vertices) * 3,
-                                                       vertices);
+    s->vertices_buffer = ngli_geometry_get_shared_attribute_buffer(node->ctx,
+                                                                   NGL_NODE_BUFFERVEC3,
+                                                                   nb_vertices,
+                                                                   nb_vertices * sizeof(*vertices) * 3,
+                                                                   vertices);
 
-    s->uvcoords_buffer = ngli_geometry_generate_buffer(node->ctx,
-                                                       NGL_NODE_BUFFERVEC2,
-                                                       nb_vertices,
-                                                       nb_vertices * sizeof(*uvcoords) * 2,
-                                                       uvcoords);
+    s->uvcoords_buffer = ngli_geometry_get_shared_attribute_buffer(node->ctx,
+                                                                   NGL_NODE_BUFFERVEC2,
+                                                                   nb_vertices,
+                                                                   nb_vertices * sizeof(*uvcoords) * 2,
+                                                                   uvcoords);
 
-    s->normals_buffer = ngli_geometry_generate_buffer(node->ctx,
-                                                      NGL_NODE_BUFFERVEC3,
-                                                      nb_vertices,
-                                                      nb_vertices * sizeof(*normals) * 3,
-                                                      normals);
+    s->normals_buffer = ngli_geometry_get_shared_attribute_buffer(node->ctx,
+                                                                  NGL_NODE_BUFFERVEC3,
+                                                                  nb_vertices,
+                                                                  nb_vertices * sizeof(*normals) * 3,
+                                                                  normals);
 
-    s->indices_buffer = ngli_geometry_generate_indices_buffer(node->ctx, nb_vertices);
+    s->indices_buffer = ngli_geometry_get_shared_indices_buffer(node->ctx, nb_vertices);
 
     if (!s->vertices_buffer || !s->uvcoords_buffer || !s->indices_buffer || !s->normals_buffer)
         goto end;
 
     s->draw_mode = GL_TRIANGLE_FAN;
 
-    ret = 0;
+    ngli_geometry_compute_bounds(node);
+
+    ret = ngli_geometry_init_interleaved_buffer(node);
 
 end:
     free(vertices);
@@ -114,21 +116,15 @@ end:
     return ret;
 }
 
-#define NODE_UNREFP(node) do {                    \
-    if (node) {                                   \
-        ngli_node_detach_ctx(node);               \
-        ngl_node_unrefp(&node);                   \
-    }                                             \
-} while (0)
-
 static void circle_uninit(struct ngl_node *node)
 {
     struct geometry *s = node->priv_data;
 
-    NODE_UNREFP(s->vertices_buffer);
-    NODE_UNREFP(s->uvcoords_buffer);
-    NODE_UNREFP(s->normals_buffer);
-    NODE_UNREFP(s->indices_buffer);
+    ngli_geometry_release_shared_buffer(&s->vertices_buffer);
+    ngli_geometry_release_shared_buffer(&s->uvcoords_buffer);
+    ngli_geometry_release_shared_buffer(&s->normals_buffer);
+    ngli_geometry_release_shared_buffer(&s->indices_buffer);
+    ngli_geometry_release_shared_buffer(&s->interleaved_buffer);
 }
 
 const struct node_class ngli_circle_class = {
@@ -78,6 +78,8 @@ static int update_uniforms(struct ngl_node *node)
     const struct glfunctions *gl = &glcontext->funcs;
 
     struct compute *s = node->priv_data;
+    struct computeprogram *program = s->program->priv_data;
+    struct uniformcache *uc = &program->uniformcache;
 
     if (s->textures) {
         int i = 0;
@@ -104,7 +106,7 @@ static int update_uniforms(struct ngl_node *node)
 
             if (textureprograminfo->dimensions_id >= 0) {
                 const float dimensions[2] = {texture->width, texture->height};
-                ngli_glUniform2fv(gl, textureprograminfo->dimensions_id, 1, dimensions);
+                ngli_uniformcache_fv(gl, uc, textureprograminfo->dimensions_id, 2, 1, dimensions);
             }
 
             i++;
@@ -119,13 +121,13 @@ static int update_uniforms(struct ngl_node *node)
             const struct uniform *u = unode->priv_data;
             const GLint uid = s->uniform_ids[i];
             switch (unode->class->id) {
-            case NGL_NODE_UNIFORMFLOAT:  ngli_glUniform1f (gl, uid,    u->scalar);                 break;
-            case NGL_NODE_UNIFORMVEC2:   ngli_glUniform2fv(gl, uid, 1, u->vector);                 break;
-            case NGL_NODE_UNIFORMVEC3:   ngli_glUniform3fv(gl, uid, 1, u->vector);                 break;
-            case NGL_NODE_UNIFORMVEC4:   ngli_glUniform4fv(gl, uid, 1, u->vector);                 break;
-            case NGL_NODE_UNIFORMINT:    ngli_glUniform1i (gl, uid,    u->ival);                   break;
-            case NGL_NODE_UNIFORMQUAT:   ngli_glUniformMatrix4fv(gl, uid, 1, GL_FALSE, u->matrix); break;
-            case NGL_NODE_UNIFORMMAT4:   ngli_glUniformMatrix4fv(gl, uid, 1, GL_FALSE, u->matrix); break;
+            case NGL_NODE_UNIFORMFLOAT:  ngli_uniformcache_1f(gl, uc, uid,       u->scalar);     break;
+            case NGL_NODE_UNIFORMVEC2:   ngli_uniformcache_fv(gl, uc, uid, 2, 1, u->vector);     break;
+            case NGL_NODE_UNIFORMVEC3:   ngli_uniformcache_fv(gl, uc, uid, 3, 1, u->vector);     break;
+            case NGL_NODE_UNIFORMVEC4:   ngli_uniformcache_fv(gl, uc, uid, 4, 1, u->vector);     break;
+            case NGL_NODE_UNIFORMINT:    ngli_uniformcache_1i(gl, uc, uid,       u->ival);       break;
+            case NGL_NODE_UNIFORMQUAT:   ngli_uniformcache_matrix4fv(gl, uc, uid, u->matrix);    break;
+            case NGL_NODE_UNIFORMMAT4:   ngli_uniformcache_matrix4fv(gl, uc, uid, u->matrix);    break;
             default:
                 LOG(ERROR, "unsupported uniform of type %s", unode->class->name);
                 break;
@@ -154,7 +156,6 @@ static int compute_init(struct ngl_node *node)
 
     struct ngl_ctx *ctx = node->ctx;
     struct glcontext *glcontext = ctx->glcontext;
-    const struct glfunctions *gl = &glcontext->funcs;
 
     struct compute *s = node->priv_data;
     struct computeprogram *program = s->program->priv_data;
@@ -203,15 +204,13 @@ static int compute_init(struct ngl_node *node)
             if (ret < 0)
                 return ret;
 
-            s->textureprograminfos[i].sampler_id = ngli_glGetUniformLocation(gl,
-                                                                             program->program_id,
-                                                                             entry->key);
+            s->textureprograminfos[i].sampler_id = ngli_programinfo_get_uniform_location(&program->info,
+                                                                                         entry->key);
 
             char name[128];
             snprintf(name, sizeof(name), "%s_dimensions", entry->key);
-            s->textureprograminfos[i].dimensions_id = ngli_glGetUniformLocation(gl,
-                                                                                program->program_id,
-                                                                                name);
+            s->textureprograminfos[i].dimensions_id = ngli_programinfo_get_uniform_location(&program->info,
+                                                                                            name);
             i++;
         }
     }
@@ -229,9 +228,8 @@ static int compute_init(struct ngl_node *node)
             ret = ngli_node_init(unode);
             if (ret < 0)
                 return ret;
-            s->uniform_ids[i] = ngli_glGetUniformLocation(gl,
-                                                          program->program_id,
-                                                          entry->key);
+            s->uniform_ids[i] = ngli_programinfo_get_uniform_location(&program->info,
+                                                                      entry->key);
             i++;
         }
     }
@@ -254,29 +252,7 @@ static int compute_init(struct ngl_node *node)
             if (ret < 0)
                 return ret;
 
-            static const GLenum props[] = {GL_BUFFER_BINDING};
-            GLsizei nb_props = 1;
-            GLint params = 0;
-            GLsizei nb_params = 1;
-            GLsizei nb_params_ret = 0;
-
-            GLuint index = ngli_glGetProgramResourceIndex(gl,
-                                                          program->program_id,
-                                                          GL_SHADER_STORAGE_BLOCK,
-                                                          entry->key);
-
-            if (index != GL_INVALID_INDEX)
-                ngli_glGetProgramResourceiv(gl,
-                                            program->program_id,
-                                            GL_SHADER_STORAGE_BLOCK,
-                                            index,
-                                            nb_props,
-                                            props,
-                                            nb_params,
-                                            &nb_params_ret,
-                                            &params);
-
-            s->buffer_ids[i] = params;
+            s->buffer_ids[i] = ngli_programinfo_get_block_binding(&program->info, entry->key);
             i++;
         }
     }
@@ -336,7 +312,7 @@ static void compute_draw(struct ngl_node *node)
     struct compute *s = node->priv_data;
     const struct computeprogram *program = s->program->priv_data;
 
-    ngli_glUseProgram(gl, program->program_id);
+    ngli_glstate_use_program(gl, &ctx->glbindings, program->program_id);
 
     update_uniforms(node);
 
@@ -113,12 +113,24 @@ fail:
 
 static int computeprogram_init(struct ngl_node *node)
 {
+    struct ngl_ctx *ctx = node->ctx;
+    struct glcontext *glcontext = ctx->glcontext;
+    const struct glfunctions *gl = &glcontext->funcs;
+
     struct computeprogram *s = node->priv_data;
 
     s->program_id = load_shader(node, s->compute);
     if (!s->program_id)
         return -1;
 
+    int ret = ngli_programinfo_init(&s->info, glcontext, s->program_id);
+    if (ret < 0) {
+        ngli_programinfo_reset(&s->info);
+        ngli_glDeleteProgram(gl, s->program_id);
+        s->program_id = 0;
+        return ret;
+    }
+
     return 0;
 }
 
@@ -130,6 +142,8 @@ static void computeprogram_uninit(struct ngl_node *node)
 
     struct computeprogram *s = node->priv_data;
 
+    ngli_programinfo_reset(&s->info);
+    ngli_uniformcache_reset(&s->uniformcache);
     ngli_glDeleteProgram(gl, s->program_id);
 }
 
@@ -30,7 +30,7 @@
 
 #define OFFSET(x) offsetof(struct fps, x)
 static const struct node_param fps_params[] = {
-    {"child", PARAM_TYPE_NODE, OFFSET(child), .flags=PARAM_FLAG_CONSTRUCTOR,
+    {"child", PARAM_TYPE_NODE, OFFSET(child), .flags=PARAM_FLAG_CONSTRUCTOR|PARAM_FLAG_DRAW_CHILD,
               .desc=NGLI_DOCSTRING("scene to benchmark")},
     {"measure_update", PARAM_TYPE_INT, OFFSET(m_update.nb), {.i64=60},
                        .desc=NGLI_DOCSTRING("window size of update measures")},
@@ -272,16 +272,23 @@ static int fps_update(struct ngl_node *node, double t)
     return ret;
 }
 
-static void fps_draw(struct ngl_node *node)
+static int fps_pre_draw(struct ngl_node *node)
+{
+    struct fps *s = node->priv_data;
+
+    if (s->m_draw.nb)
+        s->draw_start = ngli_gettime();
+    return 1;
+}
+
+static void fps_post_draw(struct ngl_node *node)
 {
     struct fps *s = node->priv_data;
 
     if (s->m_draw.nb) {
-        const int64_t draw_start = ngli_gettime();
-        ngli_node_draw(s->child);
         const int64_t draw_end = ngli_gettime();
-        const int64_t tdraw = draw_end - draw_start;
-        register_time(&s->m_draw, draw_end - draw_start);
+        const int64_t tdraw = draw_end - s->draw_start;
+        register_time(&s->m_draw, tdraw);
 
         print_report(node, 1);
         if (s->m_update.nb) {
@@ -290,8 +297,6 @@ static void fps_draw(struct ngl_node *node)
             register_time(&s->m_total, tdraw + tupdate);
             print_report(node, 2);
         }
-    } else {
-        ngli_node_draw(s->child);
     }
 }
 
@@ -307,9 +312,11 @@ static void fps_uninit(struct ngl_node *node)
 const struct node_class ngli_fps_class = {
     .id        = NGL_NODE_FPS,
     .name      = "FPS",
+    .flags     = NODE_FLAG_TIME_DEPENDENT,
     .init      = fps_init,
     .update    = fps_update,
-    .draw      = fps_draw,
+    .pre_draw  = fps_pre_draw,
+    .post_draw = fps_post_draw,
     .uninit    = fps_uninit,
     .priv_size = sizeof(struct fps),
     .params    = fps_params,
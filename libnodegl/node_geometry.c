@@ -20,12 +20,16 @@
  */
 
 #include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "hmap.h"
 #include "log.h"
 #include "nodegl.h"
 #include "nodes.h"
+#include "utils.h"
 
 #define SET_INDICES(type, count, data) do {                                    \
     type *indices = (type *)(data);                                            \
@@ -34,14 +38,15 @@
     }                                                                          \
 } while (0)
 
-struct ngl_node *ngli_geometry_generate_buffer(struct ngl_ctx *ctx, int type, int count, int size, void *data)
+static struct ngl_node *generate_buffer(struct ngl_ctx *ctx, int type, int count, int size, void *data,
+                                        int generate_gl_buffer)
 {
     struct ngl_node *node = ngl_node_create(type, count);
     if (!node)
         return NULL;
 
     struct buffer *buffer = node->priv_data;
-    buffer->generate_gl_buffer = 1;
+    buffer->generate_gl_buffer = generate_gl_buffer;
 
     if (data)
         ngl_node_param_set(node, "data", size, data);
@@ -61,24 +66,328 @@ fail:
     return NULL;
 }
 
+struct ngl_node *ngli_geometry_generate_buffer(struct ngl_ctx *ctx, int type, int count, int size, void *data)
+{
+    return generate_buffer(ctx, type, count, size, data, 1);
+}
+
+/*
+ * Generate the indices 0..count-1 with the smallest index type able to hold
+ * them. Unsigned bytes are deliberately not used: they are slow paths (or
+ * emulated) on a number of implementations.
+ */
+static uint8_t *generate_indices(struct ngl_ctx *ctx, int count, int *typep, int *sizep)
+{
+    const int use_ushort = count <= 0xffff + 1;
+    if (!use_ushort && !(ctx->glcontext->features & NGLI_FEATURE_ELEMENT_INDEX_UINT)) {
+        LOG(ERROR, "context does not support 32-bit indices, required to index %d vertices", count);
+        return NULL;
+    }
+
+    const int index_size = use_ushort ? sizeof(GLushort) : sizeof(GLuint);
+    uint8_t *data = calloc(count, index_size);
+    if (!data)
+        return NULL;
+
+    if (use_ushort)
+        SET_INDICES(GLushort, count, data);
+    else
+        SET_INDICES(GLuint, count, data);
+
+    *typep = use_ushort ? NGL_NODE_BUFFERUSHORT : NGL_NODE_BUFFERUINT;
+    *sizep = count * index_size;
+    return data;
+}
+
 struct ngl_node *ngli_geometry_generate_indices_buffer(struct ngl_ctx *ctx, int count)
 {
-    int size = count * sizeof(GLushort);
-    uint8_t *data = calloc(count, sizeof(GLushort));
+    int type, size;
+    uint8_t *data = generate_indices(ctx, count, &type, &size);
     if (!data)
         return NULL;
 
-    SET_INDICES(GLushort, count, data);
+    struct ngl_node *node = ngli_geometry_generate_buffer(ctx, type, count, size, data);
+    free(data);
+    return node;
+}
+
+/*
+ * The buffers generated by the Quad, Triangle and Circle nodes are shared
+ * within a context: they are immutable, and identical shapes (typically unit
+ * quads) are extremely common. The buffers are indexed by their type, count
+ * and content (the generation parameters determining them entirely), and
+ * destroyed when their last user releases them.
+ */
+struct shared_buffer {
+    struct ngl_node *node;
+    int refcount;
+};
+
+#define SHARED_BUFFER_KEY_SIZE 32
+
+static void get_shared_buffer_key(char *key, int type, int count, int size, const void *data,
+                                  int generate_gl_buffer)
+{
+    snprintf(key, SHARED_BUFFER_KEY_SIZE, "%08X-%d-%08X-%d",
+             (unsigned)type, count, ngli_crc32_data(data, size), generate_gl_buffer);
+}
+
+void ngli_geometry_free_shared_buffer(void *user_arg, void *data)
+{
+    struct shared_buffer *shared = data;
+    ngli_node_detach_ctx(shared->node);
+    ngl_node_unrefp(&shared->node);
+    free(shared);
+}
+
+static struct ngl_node *get_shared_buffer(struct ngl_ctx *ctx, int type, int count, int size, void *data,
+                                          int generate_gl_buffer)
+{
+    char key[SHARED_BUFFER_KEY_SIZE];
+    get_shared_buffer_key(key, type, count, size, data, generate_gl_buffer);
+
+    struct shared_buffer *shared = ngli_hmap_get(ctx->shared_buffers, key);
+    if (shared) {
+        const struct buffer *buffer = shared->node->priv_data;
+        if (buffer->data_size == size && !memcmp(buffer->data, data, size)) {
+            shared->refcount++;
+            return shared->node;
+        }
+
+        /* Hash collision, the buffer is not shared */
+        return generate_buffer(ctx, type, count, size, data, generate_gl_buffer);
+    }
+
+    struct ngl_node *node = generate_buffer(ctx, type, count, size, data, generate_gl_buffer);
+    if (!node)
+        return NULL;
+
+    shared = calloc(1, sizeof(*shared));
+    if (!shared)
+        goto fail;
+    shared->node = node;
+    shared->refcount = 1;
+
+    if (ngli_hmap_set(ctx->shared_buffers, key, shared) < 0) {
+        free(shared);
+        goto fail;
+    }
+
+    return node;
 
-    struct ngl_node *node = ngli_geometry_generate_buffer(ctx,
-                                                          NGL_NODE_BUFFERUSHORT,
-                                                          count,
-                                                          size,
-                                                          data);
+fail:
+    ngli_node_detach_ctx(node);
+    ngl_node_unrefp(&node);
+    return NULL;
+}
+
+struct ngl_node *ngli_geometry_get_shared_buffer(struct ngl_ctx *ctx, int type, int count, int size, void *data)
+{
+    return get_shared_buffer(ctx, type, count, size, data, 1);
+}
+
+/*
+ * The vertex attributes of the generated shapes are always packed into the
+ * interleaved buffer: they only need to live in memory, not in a GL buffer.
+ */
+struct ngl_node *ngli_geometry_get_shared_attribute_buffer(struct ngl_ctx *ctx, int type, int count, int size, void *data)
+{
+    return get_shared_buffer(ctx, type, count, size, data, 0);
+}
+
+struct ngl_node *ngli_geometry_get_shared_indices_buffer(struct ngl_ctx *ctx, int count)
+{
+    int type, size;
+    uint8_t *data = generate_indices(ctx, count, &type, &size);
+    if (!data)
+        return NULL;
+
+    struct ngl_node *node = ngli_geometry_get_shared_buffer(ctx, type, count, size, data);
     free(data);
     return node;
 }
 
+void ngli_geometry_release_shared_buffer(struct ngl_node **nodep)
+{
+    struct ngl_node *node = *nodep;
+    if (!node)
+        return;
+
+    struct ngl_ctx *ctx = node->ctx;
+    const struct buffer *buffer = node->priv_data;
+    char key[SHARED_BUFFER_KEY_SIZE];
+    get_shared_buffer_key(key, node->class->id, buffer->count, buffer->data_size, buffer->data,
+                          buffer->generate_gl_buffer);
+
+    struct shared_buffer *shared = ngli_hmap_get(ctx->shared_buffers, key);
+    if (shared && shared->node == node) {
+        if (!--shared->refcount)
+            ngli_hmap_set(ctx->shared_buffers, key, NULL);
+    } else {
+        ngli_node_detach_ctx(node);
+        ngl_node_unrefp(&node);
+    }
+
+    *nodep = NULL;
+}
+
+/*
+ * The usage of a buffer is only a hint: a static buffer can still be written
+ * by a compute shader or through a Render buffers block. The user buffers of
+ * a Geometry are thus only considered immutable if it is explicitly stated,
+ * while the buffers generated by the Quad, Triangle and Circle are private.
+ */
+static int is_immutable_buffer(const struct ngl_node *geometry, const struct ngl_node *node)
+{
+    const struct geometry *s = geometry->priv_data;
+    const struct buffer *buffer = node->priv_data;
+
+    if (geometry->class->id == NGL_NODE_GEOMETRY && !s->static_attributes)
+        return 0;
+
+    switch (node->class->id) {
+    case NGL_NODE_ANIMATEDBUFFERFLOAT:
+    case NGL_NODE_ANIMATEDBUFFERVEC2:
+    case NGL_NODE_ANIMATEDBUFFERVEC3:
+    case NGL_NODE_ANIMATEDBUFFERVEC4:
+        return 0;
+    }
+
+    return buffer->usage == GL_STATIC_DRAW;
+}
+
+/*
+ * Pack the vertices, uvcoords and normals into a single interleaved buffer
+ * (shared like the generated buffers) so they are fetched from one GL buffer.
+ * This is only possible when the attributes never change after their
+ * initialization.
+ */
+int ngli_geometry_init_interleaved_buffer(struct ngl_node *node)
+{
+    struct geometry *s = node->priv_data;
+
+    struct ngl_node *attributes[] = {s->vertices_buffer, s->uvcoords_buffer, s->normals_buffer};
+    int *offsets[] = {&s->vertices_offset, &s->uvcoords_offset, &s->normals_offset};
+
+    int stride = 0;
+    int nb_attributes = 0;
+    for (int i = 0; i < NGLI_ARRAY_NB(attributes); i++) {
+        if (!attributes[i])
+            continue;
+        if (!is_immutable_buffer(node, attributes[i]))
+            return 0;
+        const struct buffer *buffer = attributes[i]->priv_data;
+        *offsets[i] = stride;
+        stride += (buffer->data_stride + 3) & ~3;
+        nb_attributes++;
+    }
+
+    const struct buffer *vertices = s->vertices_buffer->priv_data;
+    const int count = vertices->count;
+    if (nb_attributes < 2 || !count)
+        return 0;
+
+    const int size = count * stride;
+    uint8_t *data = calloc(count, stride);
+    if (!data)
+        return -1;
+
+    for (int i = 0; i < NGLI_ARRAY_NB(attributes); i++) {
+        if (!attributes[i])
+            continue;
+        const struct buffer *buffer = attributes[i]->priv_data;
+        for (int j = 0; j < count; j++)
+            memcpy(data + j * stride + *offsets[i],
+                   buffer->data + j * buffer->data_stride,
+                   buffer->data_stride);
+    }
+
+    s->interleaved_buffer = ngli_geometry_get_shared_buffer(node->ctx,
+                                                            NGL_NODE_BUFFERUBYTE,
+                                                            size,
+                                                            size,
+                                                            data);
+    free(data);
+    if (!s->interleaved_buffer)
+        return -1;
+    s->interleaved_stride = stride;
+
+    return 0;
+}
+
+/*
+ * Compute the bounding box used for the frustum culling. It is only available
+ * for immutable float vertices: the geometries with other vertices are never
+ * culled.
+ */
+void ngli_geometry_compute_bounds(struct ngl_node *node)
+{
+    struct geometry *s = node->priv_data;
+    const struct buffer *vertices = s->vertices_buffer->priv_data;
+
+    s->has_bounds = 0;
+    if (s->vertices_buffer->class->id != NGL_NODE_BUFFERVEC3 ||
+        !is_immutable_buffer(node, s->vertices_buffer) || !vertices->count)
+        return;
+
+    const float *v = (const float *)vertices->data;
+    memcpy(s->bounds,     v, 3 * sizeof(*v));
+    memcpy(s->bounds + 3, v, 3 * sizeof(*v));
+    for (int i = 1; i < vertices->count; i++) {
+        v = (const float *)(vertices->data + i * vertices->data_stride);
+        for (int j = 0; j < 3; j++) {
+            s->bounds[j]     = NGLI_MIN(s->bounds[j],     v[j]);
+            s->bounds[j + 3] = NGLI_MAX(s->bounds[j + 3], v[j]);
+        }
+    }
+    s->has_bounds = 1;
+}
+
+#define COMPARE_FIELD(field) do {                                              \
+    const int ret = memcmp(&s0->field, &s1->field, sizeof(s0->field));         \
+    if (ret)                                                                   \
+        return ret;                                                            \
+} while (0)
+
+/*
+ * Order geometries by content: the generated shapes with the same parameters
+ * have the same (shared) buffers and can be drawn interchangeably, while any
+ * other geometry is only equal to itself.
+ */
+int ngli_geometry_compare(const struct ngl_node *g0, const struct ngl_node *g1)
+{
+    if (g0 == g1)
+        return 0;
+    if (!g0 || !g1)
+        return (g0 != NULL) - (g1 != NULL);
+    if (g0->class->id != g1->class->id)
+        return g0->class->id < g1->class->id ? -1 : 1;
+
+    const struct geometry *s0 = g0->priv_data;
+    const struct geometry *s1 = g1->priv_data;
+
+    switch (g0->class->id) {
+    case NGL_NODE_QUAD:
+        COMPARE_FIELD(quad_corner);
+        COMPARE_FIELD(quad_width);
+        COMPARE_FIELD(quad_height);
+        COMPARE_FIELD(quad_uv_corner);
+        COMPARE_FIELD(quad_uv_width);
+        COMPARE_FIELD(quad_uv_height);
+        return 0;
+    case NGL_NODE_TRIANGLE:
+        COMPARE_FIELD(triangle_edges);
+        COMPARE_FIELD(triangle_uvs);
+        return 0;
+    case NGL_NODE_CIRCLE:
+        COMPARE_FIELD(radius);
+        COMPARE_FIELD(npoints);
+        return 0;
+    }
+
+    return (uintptr_t)g0 < (uintptr_t)g1 ? -1 : 1;
+}
+
 static const struct param_choices draw_mode_choices = {
     .name = "draw_mode",
     .consts = {
@@ -96,27 +405,49 @@ static const struct param_choices draw_mode_choices = {
 #define TEXCOORDS_TYPES_LIST (const int[]){NGL_NODE_BUFFERFLOAT,            \
                                            NGL_NODE_BUFFERVEC2,             \
                                            NGL_NODE_BUFFERVEC3,             \
+                                           NGL_NODE_BUFFERHALFFLOAT,        \
+                                           NGL_NODE_BUFFERHVEC2,            \
+                                           NGL_NODE_BUFFERHVEC3,            \
+                                           NGL_NODE_BUFFERSVEC2,            \
+                                           NGL_NODE_BUFFERUSVEC2,           \
                                            NGL_NODE_ANIMATEDBUFFERFLOAT,    \
                                            NGL_NODE_ANIMATEDBUFFERVEC2,     \
                                            NGL_NODE_ANIMATEDBUFFERVEC3,     \
                                            -1}
 
+#define VERTICES_TYPES_LIST (const int[]){NGL_NODE_BUFFERVEC3,             \
+                                          NGL_NODE_BUFFERHVEC3,            \
+                                          NGL_NODE_BUFFERSVEC3,            \
+                                          NGL_NODE_ANIMATEDBUFFERVEC3,     \
+                                          -1}
+
+#define NORMALS_TYPES_LIST (const int[]){NGL_NODE_BUFFERVEC3,              \
+                                         NGL_NODE_BUFFERHVEC3,             \
+                                         NGL_NODE_BUFFERSVEC3,             \
+                                         NGL_NODE_BUFFERBVEC3,             \
+                                         NGL_NODE_ANIMATEDBUFFERVEC3,      \
+                                         -1}
+
 #define OFFSET(x) offsetof(struct geometry, x)
 static const struct node_param geometry_params[] = {
     {"vertices",  PARAM_TYPE_NODE, OFFSET(vertices_buffer),
-                  .node_types=(const int[]){NGL_NODE_BUFFERVEC3, NGL_NODE_ANIMATEDBUFFERVEC3, -1},
+                  .node_types=VERTICES_TYPES_LIST,
                   .flags=PARAM_FLAG_CONSTRUCTOR | PARAM_FLAG_DOT_DISPLAY_FIELDNAME},
     {"uvcoords",  PARAM_TYPE_NODE, OFFSET(uvcoords_buffer),
                   .node_types=TEXCOORDS_TYPES_LIST,
                   .flags=PARAM_FLAG_DOT_DISPLAY_FIELDNAME},
     {"normals",   PARAM_TYPE_NODE, OFFSET(normals_buffer),
-                  .node_types=(const int[]){NGL_NODE_BUFFERVEC3, NGL_NODE_ANIMATEDBUFFERVEC3, -1},
+                  .node_types=NORMALS_TYPES_LIST,
                   .flags=PARAM_FLAG_DOT_DISPLAY_FIELDNAME},
     {"indices",   PARAM_TYPE_NODE, OFFSET(indices_buffer),
                   .node_types=(const int[]){NGL_NODE_BUFFERUBYTE, NGL_NODE_BUFFERUINT, NGL_NODE_BUFFERUSHORT, -1},
                   .flags=PARAM_FLAG_DOT_DISPLAY_FIELDNAME},
     {"draw_mode", PARAM_TYPE_SELECT, OFFSET(draw_mode), {.i64=GL_TRIANGLES},
                   .choices=&draw_mode_choices},
+    {"static_attributes", PARAM_TYPE_BOOL, OFFSET(static_attributes), {.i64=0},
+                  .desc=NGLI_DOCSTRING("`vertices`, `uvcoords` and `normals` are never modified once initialized, "
+                                       "allowing them to be packed into a single interleaved buffer and "
+                                       "their bounds to be used for the frustum culling")},
     {NULL}
 };
 
@@ -172,6 +503,13 @@ static int geometry_init(struct ngl_node *node)
         int ret = ngli_node_init(s->indices_buffer);
         if (ret < 0)
             return ret;
+
+        struct glcontext *glcontext = node->ctx->glcontext;
+        if (buffer->data_comp_type == GL_UNSIGNED_INT &&
+            !(glcontext->features & NGLI_FEATURE_ELEMENT_INDEX_UINT)) {
+            LOG(ERROR, "context does not support 32-bit indices");
+            return -1;
+        }
     } else {
         s->indices_buffer = ngli_geometry_generate_indices_buffer(node->ctx,
                                                                   vertices->count);
@@ -179,7 +517,9 @@ static int geometry_init(struct ngl_node *node)
             return -1;
     }
 
-    return 0;
+    ngli_geometry_compute_bounds(node);
+
+    return ngli_geometry_init_interleaved_buffer(node);
 }
 
 static int geometry_update(struct ngl_node *node, double t)
@@ -205,11 +545,19 @@ static int geometry_update(struct ngl_node *node, double t)
     return 0;
 }
 
+static void geometry_uninit(struct ngl_node *node)
+{
+    struct geometry *s = node->priv_data;
+
+    ngli_geometry_release_shared_buffer(&s->interleaved_buffer);
+}
+
 const struct node_class ngli_geometry_class = {
     .id        = NGL_NODE_GEOMETRY,
     .name      = "Geometry",
     .init      = geometry_init,
     .update    = geometry_update,
+    .uninit    = geometry_uninit,
     .priv_size = sizeof(struct geometry),
     .params    = geometry_params,
     .file      = __FILE__,
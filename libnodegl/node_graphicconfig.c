@@ -104,7 +104,7 @@ static const struct param_choices stencil_op_choices = {
 
 #define OFFSET(x) offsetof(struct graphicconfig, x)
 static const struct node_param graphicconfig_params[] = {
-    {"child",              PARAM_TYPE_NODE,   OFFSET(child),              .flags=PARAM_FLAG_CONSTRUCTOR},
+    {"child",              PARAM_TYPE_NODE,   OFFSET(child),              .flags=PARAM_FLAG_CONSTRUCTOR|PARAM_FLAG_DRAW_CHILD},
     {"blend",              PARAM_TYPE_BOOL,   OFFSET(blend),              {.i64=-1}},
     {"blend_src_factor",   PARAM_TYPE_SELECT, OFFSET(blend_src_factor),   {.i64=-1},
                            .choices=&blend_factor_choices},
@@ -203,12 +203,14 @@ static void honor_config(struct ngl_node *node, int restore)
     ngli_glstate_honor_state(gl, next, prev);
 }
 
-static void graphicconfig_draw(struct ngl_node *node)
+static int graphicconfig_pre_draw(struct ngl_node *node)
 {
-    struct graphicconfig *s = node->priv_data;
-
     honor_config(node, 0);
-    ngli_node_draw(s->child);
+    return 1;
+}
+
+static void graphicconfig_post_draw(struct ngl_node *node)
+{
     honor_config(node, 1);
 }
 
@@ -216,7 +218,8 @@ const struct node_class ngli_graphicconfig_class = {
     .id        = NGL_NODE_GRAPHICCONFIG,
     .name      = "GraphicConfig",
     .update    = graphicconfig_update,
-    .draw      = graphicconfig_draw,
+    .pre_draw  = graphicconfig_pre_draw,
+    .post_draw = graphicconfig_post_draw,
     .priv_size = sizeof(struct graphicconfig),
     .params    = graphicconfig_params,
     .file      = __FILE__,
@@ -25,15 +25,13 @@
 #include "nodegl.h"
 #include "nodes.h"
 
-struct group {
-    struct ngl_node **children;
-    int nb_children;
-};
-
 #define OFFSET(x) offsetof(struct group, x)
 static const struct node_param group_params[] = {
-    {"children", PARAM_TYPE_NODELIST, OFFSET(children),
+    {"children", PARAM_TYPE_NODELIST, OFFSET(children), .flags=PARAM_FLAG_DRAW_CHILD,
                  .desc=NGLI_DOCSTRING("a set of scenes")},
+    {"sort_draws", PARAM_TYPE_BOOL, OFFSET(sort_draws), {.i64=0}, .flags=PARAM_FLAG_DRAW_ORDER,
+                   .desc=NGLI_DOCSTRING("declare the drawing order of the children as irrelevant, "
+                                        "allowing their draws to be sorted by program, textures and geometry")},
     {NULL}
 };
 
@@ -45,26 +43,15 @@ static int group_update(struct ngl_node *node, double t)
         struct ngl_node *child = s->children[i];
         memcpy(child->modelview_matrix, node->modelview_matrix, sizeof(node->modelview_matrix));
         memcpy(child->projection_matrix, node->projection_matrix, sizeof(node->projection_matrix));
-        int ret = ngli_node_update(child, t);
-        if (ret < 0)
-            return ret;
     }
 
-    return 0;
-}
-
-static void group_draw(struct ngl_node *node)
-{
-    struct group *s = node->priv_data;
-    for (int i = 0; i < s->nb_children; i++)
-        ngli_node_draw(s->children[i]);
+    return ngli_node_update_parallel(node, s->children, s->nb_children, t);
 }
 
 const struct node_class ngli_group_class = {
     .id        = NGL_NODE_GROUP,
     .name      = "Group",
     .update    = group_update,
-    .draw      = group_draw,
     .priv_size = sizeof(struct group),
     .params    = group_params,
     .file      = __FILE__,
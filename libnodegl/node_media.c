@@ -286,6 +286,7 @@ static void media_uninit(struct ngl_node *node)
 const struct node_class ngli_media_class = {
     .id        = NGL_NODE_MEDIA,
     .name      = "Media",
+    .flags     = NODE_FLAG_TIME_DEPENDENT,
     .init      = media_init,
     .prefetch  = media_prefetch,
     .update    = media_update,
@@ -87,9 +87,9 @@ static const char default_vertex_shader[] =
 
 #define OFFSET(x) offsetof(struct program, x)
 static const struct node_param program_params[] = {
-    {"vertex",   PARAM_TYPE_STR, OFFSET(vertex),   {.str=default_vertex_shader},
+    {"vertex",   PARAM_TYPE_STR, OFFSET(vertex),   {.str=default_vertex_shader}, .flags=PARAM_FLAG_DRAW_ORDER,
                  .desc=NGLI_DOCSTRING("vertex shader")},
-    {"fragment", PARAM_TYPE_STR, OFFSET(fragment), {.str=default_fragment_shader},
+    {"fragment", PARAM_TYPE_STR, OFFSET(fragment), {.str=default_fragment_shader}, .flags=PARAM_FLAG_DRAW_ORDER,
                  .desc=NGLI_DOCSTRING("fragment shader")},
     {NULL}
 };
@@ -129,7 +129,12 @@ static GLuint load_program(struct ngl_node *node, const char *vertex, const char
 
     GLint result = GL_FALSE;
 
-    GLuint program = ngli_glCreateProgram(gl);
+    struct programcache *programcache = ctx->programcache;
+    GLuint program = ngli_programcache_load_binary(programcache, glcontext, vertex, fragment);
+    if (program)
+        return program;
+
+    program = ngli_glCreateProgram(gl);
     GLuint vertex_shader = ngli_glCreateShader(gl, GL_VERTEX_SHADER);
     GLuint fragment_shader = ngli_glCreateShader(gl, GL_FRAGMENT_SHADER);
 
@@ -153,6 +158,8 @@ static GLuint load_program(struct ngl_node *node, const char *vertex, const char
 
     ngli_glAttachShader(gl, program, vertex_shader);
     ngli_glAttachShader(gl, program, fragment_shader);
+    if (ngli_programcache_has_binaries(programcache, glcontext))
+        ngli_glProgramParameteri(gl, program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
     ngli_glLinkProgram(gl, program);
 
     ngli_glGetProgramiv(gl, program, GL_LINK_STATUS, &result);
@@ -164,6 +171,8 @@ static GLuint load_program(struct ngl_node *node, const char *vertex, const char
     ngli_glDeleteShader(gl, vertex_shader);
     ngli_glDeleteShader(gl, fragment_shader);
 
+    ngli_programcache_save_binary(programcache, glcontext, program, vertex, fragment);
+
     return program;
 
 fail:
@@ -195,16 +204,39 @@ static int program_init(struct ngl_node *node)
 
     struct program *s = node->priv_data;
 
-    s->program_id = load_program(node, s->vertex, s->fragment);
-    if (!s->program_id)
-        return -1;
+    s->cache_entry = ngli_programcache_get(ctx->programcache, s->vertex, s->fragment);
+    if (!s->cache_entry) {
+        GLuint program_id = load_program(node, s->vertex, s->fragment);
+        if (!program_id)
+            return -1;
+
+        s->cache_entry = ngli_programcache_add(ctx->programcache, s->vertex, s->fragment, program_id);
+        if (!s->cache_entry) {
+            ngli_glDeleteProgram(gl, program_id);
+            return -1;
+        }
+
+        int ret = ngli_programinfo_init(&s->cache_entry->info, glcontext, program_id);
+        if (ret < 0) {
+            ngli_programcache_release(ctx->programcache, gl, &s->cache_entry);
+            return ret;
+        }
+    }
+
+    s->program_id   = s->cache_entry->program_id;
+    s->info         = &s->cache_entry->info;
+    s->uniformcache = &s->cache_entry->uniformcache;
+
+    s->position_location_id          = ngli_programinfo_get_attribute_location(s->info, "ngl_position");
+    s->uvcoord_location_id           = ngli_programinfo_get_attribute_location(s->info, "ngl_uvcoord");
+    s->normal_location_id            = ngli_programinfo_get_attribute_location(s->info, "ngl_normal");
+    s->modelview_matrix_location_id  = ngli_programinfo_get_uniform_location(s->info,   "ngl_modelview_matrix");
+    s->projection_matrix_location_id = ngli_programinfo_get_uniform_location(s->info,   "ngl_projection_matrix");
+    s->normal_matrix_location_id     = ngli_programinfo_get_uniform_location(s->info,   "ngl_normal_matrix");
 
-    s->position_location_id          = ngli_glGetAttribLocation(gl, s->program_id,  "ngl_position");
-    s->uvcoord_location_id           = ngli_glGetAttribLocation(gl, s->program_id,  "ngl_uvcoord");
-    s->normal_location_id            = ngli_glGetAttribLocation(gl, s->program_id,  "ngl_normal");
-    s->modelview_matrix_location_id  = ngli_glGetUniformLocation(gl, s->program_id, "ngl_modelview_matrix");
-    s->projection_matrix_location_id = ngli_glGetUniformLocation(gl, s->program_id, "ngl_projection_matrix");
-    s->normal_matrix_location_id     = ngli_glGetUniformLocation(gl, s->program_id, "ngl_normal_matrix");
+    /* Instanced programs read these matrices from per-instance attributes */
+    s->modelview_matrix_attrib_id    = ngli_programinfo_get_attribute_location(s->info, "ngl_modelview_matrix");
+    s->normal_matrix_attrib_id       = ngli_programinfo_get_attribute_location(s->info, "ngl_normal_matrix");
 
     return 0;
 }
@@ -217,7 +249,9 @@ static void program_uninit(struct ngl_node *node)
 
     struct program *s = node->priv_data;
 
-    ngli_glDeleteProgram(gl, s->program_id);
+    ngli_programcache_release(ctx->programcache, gl, &s->cache_entry);
+    s->info = NULL;
+    s->uniformcache = NULL;
 }
 
 const struct node_class ngli_program_class = {
@@ -31,12 +31,12 @@
 
 #define OFFSET(x) offsetof(struct geometry, x)
 static const struct node_param quad_params[] = {
-    {"corner",    PARAM_TYPE_VEC3, OFFSET(quad_corner),    {.vec={-0.5f, -0.5f}}},
-    {"width",     PARAM_TYPE_VEC3, OFFSET(quad_width),     {.vec={ 1.0f,  0.0f}}},
-    {"height",    PARAM_TYPE_VEC3, OFFSET(quad_height),    {.vec={ 0.0f,  1.0f}}},
-    {"uv_corner", PARAM_TYPE_VEC2, OFFSET(quad_uv_corner), {.vec={0.0f, 0.0f}}},
-    {"uv_width",  PARAM_TYPE_VEC2, OFFSET(quad_uv_width),  {.vec={1.0f, 0.0f}}},
-    {"uv_height", PARAM_TYPE_VEC2, OFFSET(quad_uv_height), {.vec={0.0f, 1.0f}}},
+    {"corner",    PARAM_TYPE_VEC3, OFFSET(quad_corner),    {.vec={-0.5f, -0.5f}}, .flags=PARAM_FLAG_DRAW_ORDER},
+    {"width",     PARAM_TYPE_VEC3, OFFSET(quad_width),     {.vec={ 1.0f,  0.0f}}, .flags=PARAM_FLAG_DRAW_ORDER},
+    {"height",    PARAM_TYPE_VEC3, OFFSET(quad_height),    {.vec={ 0.0f,  1.0f}}, .flags=PARAM_FLAG_DRAW_ORDER},
+    {"uv_corner", PARAM_TYPE_VEC2, OFFSET(quad_uv_corner), {.vec={0.0f, 0.0f}},   .flags=PARAM_FLAG_DRAW_ORDER},
+    {"uv_width",  PARAM_TYPE_VEC2, OFFSET(quad_uv_width),  {.vec={1.0f, 0.0f}},   .flags=PARAM_FLAG_DRAW_ORDER},
+    {"uv_height", PARAM_TYPE_VEC2, OFFSET(quad_uv_height), {.vec={0.0f, 1.0f}},   .flags=PARAM_FLAG_DRAW_ORDER},
     {NULL}
 };
 
@@ -68,19 +68,19 @@ static int quad_init(struct ngl_node *node)
         UV_C(0) + UV_H(0),           1.0f - UV_C(1) - UV_H(1),
     };
 
-    s->vertices_buffer = ngli_geometry_generate_buffer(node->ctx,
-                                                       NGL_NODE_BUFFERVEC3,
-                                                       NB_VERTICES,
-                                                       sizeof(vertices),
-                                                       (void *)vertices);
+    s->vertices_buffer = ngli_geometry_get_shared_attribute_buffer(node->ctx,
+                                                                   NGL_NODE_BUFFERVEC3,
+                                                                   NB_VERTICES,
+                                                                   sizeof(vertices),
+                                                                   (void *)vertices);
     if (!s->vertices_buffer)
         return -1;
 
-    s->uvcoords_buffer = ngli_geometry_generate_buffer(node->ctx,
-                                                       NGL_NODE_BUFFERVEC2,
-                                                       NB_VERTICES,
-                                                       sizeof(uvs),
-                                                       (void *)uvs);
+    s->uvcoords_buffer = ngli_geometry_get_shared_attribute_buffer(node->ctx,
+                                                                   NGL_NODE_BUFFERVEC2,
+                                                                   NB_VERTICES,
+                                                                   sizeof(uvs),
+                                                                   (void *)uvs);
     if (!s->uvcoords_buffer)
         return -1;
 
@@ -93,40 +93,36 @@ static int quad_init(struct ngl_node *node)
     for (int i = 1; i < NB_VERTICES; i++)
         memcpy(normals + (i * 3), normals, 3 * sizeof(*normals));
 
-    s->normals_buffer = ngli_geometry_generate_buffer(node->ctx,
-                                                      NGL_NODE_BUFFERVEC3,
-                                                      NB_VERTICES,
-                                                      sizeof(normals),
-                                                      normals);
+    s->normals_buffer = ngli_geometry_get_shared_attribute_buffer(node->ctx,
+                                                                  NGL_NODE_BUFFERVEC3,
+                                                                  NB_VERTICES,
+                                                                  sizeof(normals),
+                                                                  normals);
     if (!s->normals_buffer)
         return -1;
 
 
-    s->indices_buffer = ngli_geometry_generate_indices_buffer(node->ctx,
-                                                              NB_VERTICES);
+    s->indices_buffer = ngli_geometry_get_shared_indices_buffer(node->ctx,
+                                                                NB_VERTICES);
     if (!s->indices_buffer)
         return -1;
 
     s->draw_mode = GL_TRIANGLE_FAN;
 
-    return 0;
-}
+    ngli_geometry_compute_bounds(node);
 
-#define NODE_UNREFP(node) do {                    \
-    if (node) {                                   \
-        ngli_node_detach_ctx(node);               \
-        ngl_node_unrefp(&node);                   \
-    }                                             \
-} while (0)
+    return ngli_geometry_init_interleaved_buffer(node);
+}
 
 static void quad_uninit(struct ngl_node *node)
 {
     struct geometry *s = node->priv_data;
 
-    NODE_UNREFP(s->vertices_buffer);
-    NODE_UNREFP(s->uvcoords_buffer);
-    NODE_UNREFP(s->normals_buffer);
-    NODE_UNREFP(s->indices_buffer);
+    ngli_geometry_release_shared_buffer(&s->vertices_buffer);
+    ngli_geometry_release_shared_buffer(&s->uvcoords_buffer);
+    ngli_geometry_release_shared_buffer(&s->normals_buffer);
+    ngli_geometry_release_shared_buffer(&s->indices_buffer);
+    ngli_geometry_release_shared_buffer(&s->interleaved_buffer);
 }
 
 const struct node_class ngli_quad_class = {
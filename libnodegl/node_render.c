@@ -20,6 +20,7 @@
  */
 
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -44,10 +45,30 @@
                                           NGL_NODE_UNIFORMMAT4,       \
                                           -1}
 
-#define ATTRIBUTES_TYPES_LIST (const int[]){NGL_NODE_BUFFERFLOAT,   \
-                                            NGL_NODE_BUFFERVEC2,    \
-                                            NGL_NODE_BUFFERVEC3,    \
-                                            NGL_NODE_BUFFERVEC4,    \
+#define ATTRIBUTES_TYPES_LIST (const int[]){NGL_NODE_BUFFERBYTE,      \
+                                            NGL_NODE_BUFFERBVEC2,     \
+                                            NGL_NODE_BUFFERBVEC3,     \
+                                            NGL_NODE_BUFFERBVEC4,     \
+                                            NGL_NODE_BUFFERSHORT,     \
+                                            NGL_NODE_BUFFERSVEC2,     \
+                                            NGL_NODE_BUFFERSVEC3,     \
+                                            NGL_NODE_BUFFERSVEC4,     \
+                                            NGL_NODE_BUFFERUBYTE,     \
+                                            NGL_NODE_BUFFERUBVEC2,    \
+                                            NGL_NODE_BUFFERUBVEC3,    \
+                                            NGL_NODE_BUFFERUBVEC4,    \
+                                            NGL_NODE_BUFFERUSHORT,    \
+                                            NGL_NODE_BUFFERUSVEC2,    \
+                                            NGL_NODE_BUFFERUSVEC3,    \
+                                            NGL_NODE_BUFFERUSVEC4,    \
+                                            NGL_NODE_BUFFERHALFFLOAT, \
+                                            NGL_NODE_BUFFERHVEC2,     \
+                                            NGL_NODE_BUFFERHVEC3,     \
+                                            NGL_NODE_BUFFERHVEC4,     \
+                                            NGL_NODE_BUFFERFLOAT,     \
+                                            NGL_NODE_BUFFERVEC2,      \
+                                            NGL_NODE_BUFFERVEC3,      \
+                                            NGL_NODE_BUFFERVEC4,      \
                                             -1}
 
 #define GEOMETRY_TYPES_LIST (const int[]){NGL_NODE_CIRCLE,          \
@@ -76,11 +97,11 @@
 
 #define OFFSET(x) offsetof(struct render, x)
 static const struct node_param render_params[] = {
-    {"geometry", PARAM_TYPE_NODE, OFFSET(geometry), .flags=PARAM_FLAG_CONSTRUCTOR,
+    {"geometry", PARAM_TYPE_NODE, OFFSET(geometry), .flags=PARAM_FLAG_CONSTRUCTOR|PARAM_FLAG_DRAW_ORDER,
                  .node_types=GEOMETRY_TYPES_LIST},
-    {"program",  PARAM_TYPE_NODE, OFFSET(program),
+    {"program",  PARAM_TYPE_NODE, OFFSET(program), .flags=PARAM_FLAG_DRAW_ORDER,
                  .node_types=(const int[]){NGL_NODE_PROGRAM, -1}},
-    {"textures", PARAM_TYPE_NODEDICT, OFFSET(textures),
+    {"textures", PARAM_TYPE_NODEDICT, OFFSET(textures), .flags=PARAM_FLAG_DRAW_ORDER,
                  .node_types=TEXTURES_TYPES_LIST},
     {"uniforms", PARAM_TYPE_NODEDICT, OFFSET(uniforms),
                  .node_types=UNIFORMS_TYPES_LIST},
@@ -88,89 +109,189 @@ static const struct node_param render_params[] = {
                  .node_types=ATTRIBUTES_TYPES_LIST},
     {"buffers",  PARAM_TYPE_NODEDICT, OFFSET(buffers),
                  .node_types=BUFFERS_TYPES_LIST},
+    {"uniform_block", PARAM_TYPE_STR, OFFSET(uniform_block),
+                      .desc=NGLI_DOCSTRING("name of a `std140` uniform block of the program; the `uniforms` and "
+                                           "`ngl_*` matrices declared in it are packed and uploaded at once")},
+    {"indirect_buffer", PARAM_TYPE_NODE, OFFSET(indirect_buffer),
+                        .node_types=(const int[]){NGL_NODE_BUFFERUINT, -1},
+                        .desc=NGLI_DOCSTRING("draw commands of 5 unsigned integers each (`count`, `instance_count`, "
+                                             "`first_index`, `base_vertex`, `base_instance`) indexing the geometry, "
+                                             "typically written by a `Compute` node through its `buffers`; "
+                                             "the geometry indices cannot be unsigned bytes")},
+    {"frustum_culling", PARAM_TYPE_BOOL, OFFSET(frustum_culling), {.i64=0},
+                        .desc=NGLI_DOCSTRING("skip the draw when the geometry bounds are outside of the view frustum; "
+                                             "the vertex shader must not move the vertices beyond their "
+                                             "`ngl_projection_matrix * ngl_modelview_matrix` transform")},
     {NULL}
 };
 
-static inline void bind_texture(const struct glfunctions *gl, GLenum target, GLint uniform_location, GLuint texture_id, int idx)
+#define DRAW_ELEMENTS_INDIRECT_COMMAND_SIZE (5 * sizeof(GLuint))
+
+static inline void bind_texture(const struct glfunctions *gl, struct glbindings *bindings, struct uniformcache *uc, GLenum target, GLint uniform_location, GLuint texture_id, int idx)
 {
-    ngli_glActiveTexture(gl, GL_TEXTURE0 + idx);
-    ngli_glBindTexture(gl, target, texture_id);
-    ngli_glUniform1i(gl, uniform_location, idx);
+    ngli_glstate_active_texture(gl, bindings, GL_TEXTURE0 + idx);
+    ngli_glstate_bind_texture(gl, bindings, target, texture_id);
+    ngli_uniformcache_1i(gl, uc, uniform_location, idx);
 }
 
 #define SAMPLING_MODE_NONE         0
 #define SAMPLING_MODE_2D           1
 #define SAMPLING_MODE_EXTERNAL_OES 2
 
+static void write_uniform_block_data(struct render *s, int offset, const void *data, int size)
+{
+    if (offset < 0 || offset + size > s->ubo_size)
+        return;
+
+    uint8_t *dst = s->ubo_data + offset;
+    if (!memcmp(dst, data, size))
+        return;
+
+    memcpy(dst, data, size);
+    s->ubo_dirty = 1;
+}
+
+static void write_uniform_block_field(struct render *s, const struct uniformblockfield *field,
+                                      const void *data, int col_size, int nb_cols, int count)
+{
+    const uint8_t *src = data;
+    count = NGLI_MIN(count, field->size);
+    for (int i = 0; i < count; i++) {
+        const int offset = field->offset + i * field->array_stride;
+        for (int j = 0; j < nb_cols; j++) {
+            write_uniform_block_data(s, offset + j * field->matrix_stride, src, col_size);
+            src += col_size;
+        }
+    }
+}
+
+static void pack_uniform(struct render *s, const struct uniformblockfield *field,
+                         const struct ngl_node *unode)
+{
+    switch (unode->class->id) {
+    case NGL_NODE_UNIFORMFLOAT: {
+        const struct uniform *u = unode->priv_data;
+        const float v = u->scalar;
+        write_uniform_block_field(s, field, &v, sizeof(v), 1, 1);
+        break;
+    }
+    case NGL_NODE_UNIFORMVEC2: {
+        const struct uniform *u = unode->priv_data;
+        write_uniform_block_field(s, field, u->vector, 2 * sizeof(*u->vector), 1, 1);
+        break;
+    }
+    case NGL_NODE_UNIFORMVEC3: {
+        const struct uniform *u = unode->priv_data;
+        write_uniform_block_field(s, field, u->vector, 3 * sizeof(*u->vector), 1, 1);
+        break;
+    }
+    case NGL_NODE_UNIFORMVEC4: {
+        const struct uniform *u = unode->priv_data;
+        write_uniform_block_field(s, field, u->vector, 4 * sizeof(*u->vector), 1, 1);
+        break;
+    }
+    case NGL_NODE_UNIFORMINT: {
+        const struct uniform *u = unode->priv_data;
+        const int32_t v = u->ival;
+        write_uniform_block_field(s, field, &v, sizeof(v), 1, 1);
+        break;
+    }
+    case NGL_NODE_UNIFORMQUAT:
+    case NGL_NODE_UNIFORMMAT4: {
+        const struct uniform *u = unode->priv_data;
+        write_uniform_block_field(s, field, u->matrix, 4 * sizeof(*u->matrix), 4, 1);
+        break;
+    }
+    case NGL_NODE_BUFFERFLOAT:
+    case NGL_NODE_BUFFERVEC2:
+    case NGL_NODE_BUFFERVEC3:
+    case NGL_NODE_BUFFERVEC4: {
+        const struct buffer *buffer = unode->priv_data;
+        write_uniform_block_field(s, field, buffer->data, buffer->data_comp * sizeof(GLfloat), 1, buffer->count);
+        break;
+    }
+    default:
+        LOG(ERROR, "unsupported uniform of type %s", unode->class->name);
+        break;
+    }
+}
+
 static int update_uniforms(struct ngl_node *node)
 {
     struct ngl_ctx *ctx = node->ctx;
     struct glcontext *glcontext = ctx->glcontext;
     const struct glfunctions *gl = &glcontext->funcs;
+    struct glbindings *bindings = &ctx->glbindings;
 
     struct render *s = node->priv_data;
     struct program *program = s->program->priv_data;
+    struct uniformcache *uc = program->uniformcache;
 
     if (s->uniforms) {
         int i = 0;
         const struct hmap_entry *entry = NULL;
         while ((entry = ngli_hmap_next(s->uniforms, entry))) {
             const struct ngl_node *unode = entry->data;
+            if (s->uniform_block_fields && s->uniform_block_fields[i].offset >= 0) {
+                pack_uniform(s, &s->uniform_block_fields[i], unode);
+                i++;
+                continue;
+            }
             const GLint uid = s->uniform_ids[i];
             switch (unode->class->id) {
             case NGL_NODE_UNIFORMFLOAT: {
                 const struct uniform *u = unode->priv_data;
-                ngli_glUniform1f(gl, uid, u->scalar);
+                ngli_uniformcache_1f(gl, uc, uid, u->scalar);
                 break;
             }
             case NGL_NODE_UNIFORMVEC2: {
                 const struct uniform *u = unode->priv_data;
-                ngli_glUniform2fv(gl, uid, 1, u->vector);
+                ngli_uniformcache_fv(gl, uc, uid, 2, 1, u->vector);
                 break;
             }
             case NGL_NODE_UNIFORMVEC3: {
                 const struct uniform *u = unode->priv_data;
-                ngli_glUniform3fv(gl, uid, 1, u->vector);
+                ngli_uniformcache_fv(gl, uc, uid, 3, 1, u->vector);
                 break;
             }
             case NGL_NODE_UNIFORMVEC4: {
                 const struct uniform *u = unode->priv_data;
-                ngli_glUniform4fv(gl, uid, 1, u->vector);
+                ngli_uniformcache_fv(gl, uc, uid, 4, 1, u->vector);
                 break;
             }
             case NGL_NODE_UNIFORMINT: {
                 const struct uniform *u = unode->priv_data;
-                ngli_glUniform1i(gl, uid, u->ival);
+                ngli_uniformcache_1i(gl, uc, uid, u->ival);
                 break;
             }
             case NGL_NODE_UNIFORMQUAT: {
                 const struct uniform *u = unode->priv_data;
-                ngli_glUniformMatrix4fv(gl, uid, 1, GL_FALSE, u->matrix);
+                ngli_uniformcache_matrix4fv(gl, uc, uid, u->matrix);
                 break;
             }
             case NGL_NODE_UNIFORMMAT4: {
                 const struct uniform *u = unode->priv_data;
-                ngli_glUniformMatrix4fv(gl, uid, 1, GL_FALSE, u->matrix);
+                ngli_uniformcache_matrix4fv(gl, uc, uid, u->matrix);
                 break;
             }
             case NGL_NODE_BUFFERFLOAT: {
                 const struct buffer *buffer = unode->priv_data;
-                ngli_glUniform1fv(gl, uid, buffer->count, (const GLfloat *)buffer->data);
+                ngli_uniformcache_fv(gl, uc, uid, 1, buffer->count, (const GLfloat *)buffer->data);
                 break;
             }
             case NGL_NODE_BUFFERVEC2: {
                 const struct buffer *buffer = unode->priv_data;
-                ngli_glUniform2fv(gl, uid, buffer->count, (const GLfloat *)buffer->data);
+                ngli_uniformcache_fv(gl, uc, uid, 2, buffer->count, (const GLfloat *)buffer->data);
                 break;
             }
             case NGL_NODE_BUFFERVEC3: {
                 const struct buffer *buffer = unode->priv_data;
-                ngli_glUniform3fv(gl, uid, buffer->count, (const GLfloat *)buffer->data);
+                ngli_uniformcache_fv(gl, uc, uid, 3, buffer->count, (const GLfloat *)buffer->data);
                 break;
             }
             case NGL_NODE_BUFFERVEC4: {
                 const struct buffer *buffer = unode->priv_data;
-                ngli_glUniform4fv(gl, uid, buffer->count, (const GLfloat *)buffer->data);
+                ngli_uniformcache_fv(gl, uc, uid, 4, buffer->count, (const GLfloat *)buffer->data);
                 break;
             }
             default:
@@ -187,10 +308,10 @@ static int update_uniforms(struct ngl_node *node)
         const struct hmap_entry *entry = NULL;
 
         if (s->disable_1st_texture_unit) {
-            ngli_glActiveTexture(gl, GL_TEXTURE0);
-            ngli_glBindTexture(gl, GL_TEXTURE_2D, 0);
+            ngli_glstate_active_texture(gl, bindings, GL_TEXTURE0);
+            ngli_glstate_bind_texture(gl, bindings, GL_TEXTURE_2D, 0);
 #ifdef TARGET_ANDROID
-            ngli_glBindTexture(gl, GL_TEXTURE_EXTERNAL_OES, 0);
+            ngli_glstate_bind_texture(gl, bindings, GL_TEXTURE_EXTERNAL_OES, 0);
 #endif
             texture_index = 1;
         }
@@ -205,44 +326,44 @@ static int update_uniforms(struct ngl_node *node)
             case GL_TEXTURE_2D:
                 if (info->sampler_id >= 0) {
                     sampling_mode = SAMPLING_MODE_2D;
-                    bind_texture(gl, texture->target, info->sampler_id, texture->id, texture_index);
+                    bind_texture(gl, bindings, uc, texture->target, info->sampler_id, texture->id, texture_index);
                 }
 
                 if (info->external_sampler_id >= 0)
-                    ngli_glUniform1i(gl, info->external_sampler_id, 0);
+                    ngli_uniformcache_1i(gl, uc, info->external_sampler_id, 0);
                 break;
             case GL_TEXTURE_3D:
-                bind_texture(gl, texture->target, info->sampler_id, texture->id, texture_index);
+                bind_texture(gl, bindings, uc, texture->target, info->sampler_id, texture->id, texture_index);
                 break;
 #ifdef TARGET_ANDROID
             case GL_TEXTURE_EXTERNAL_OES:
                 if (info->sampler_id >= 0)
-                    ngli_glUniform1i(gl, info->sampler_id, 0);
+                    ngli_uniformcache_1i(gl, uc, info->sampler_id, 0);
 
                 if (info->external_sampler_id >= 0) {
                     sampling_mode = SAMPLING_MODE_EXTERNAL_OES;
-                    bind_texture(gl, texture->target, info->external_sampler_id, texture->id, texture_index);
+                    bind_texture(gl, bindings, uc, texture->target, info->external_sampler_id, texture->id, texture_index);
                 }
                 break;
 #endif
             }
 
             if (info->sampling_mode_id >= 0)
-                ngli_glUniform1i(gl, info->sampling_mode_id, sampling_mode);
+                ngli_uniformcache_1i(gl, uc, info->sampling_mode_id, sampling_mode);
 
             if (info->coord_matrix_id >= 0)
-                ngli_glUniformMatrix4fv(gl, info->coord_matrix_id, 1, GL_FALSE, texture->coordinates_matrix);
+                ngli_uniformcache_matrix4fv(gl, uc, info->coord_matrix_id, texture->coordinates_matrix);
 
             if (info->dimensions_id >= 0) {
                 const float dimensions[3] = {texture->width, texture->height, texture->depth};
                 if (texture->target == GL_TEXTURE_3D)
-                    ngli_glUniform3fv(gl, info->dimensions_id, 1, dimensions);
+                    ngli_uniformcache_fv(gl, uc, info->dimensions_id, 3, 1, dimensions);
                 else
-                    ngli_glUniform2fv(gl, info->dimensions_id, 1, dimensions);
+                    ngli_uniformcache_fv(gl, uc, info->dimensions_id, 2, 1, dimensions);
             }
 
             if (info->ts_id >= 0)
-                ngli_glUniform1f(gl, info->ts_id, texture->data_src_ts);
+                ngli_uniformcache_1f(gl, uc, info->ts_id, texture->data_src_ts);
 
             i++;
             texture_index++;
@@ -250,58 +371,95 @@ static int update_uniforms(struct ngl_node *node)
     }
 
     if (program->modelview_matrix_location_id >= 0) {
-        ngli_glUniformMatrix4fv(gl, program->modelview_matrix_location_id, 1, GL_FALSE, node->modelview_matrix);
+        ngli_uniformcache_matrix4fv(gl, uc, program->modelview_matrix_location_id, node->modelview_matrix);
     }
 
     if (program->projection_matrix_location_id >= 0) {
-        ngli_glUniformMatrix4fv(gl, program->projection_matrix_location_id, 1, GL_FALSE, node->projection_matrix);
+        ngli_uniformcache_matrix4fv(gl, uc, program->projection_matrix_location_id, node->projection_matrix);
     }
 
-    if (program->normal_matrix_location_id >= 0) {
+    if (program->normal_matrix_location_id >= 0 || s->normal_matrix_field.offset >= 0) {
         float normal_matrix[3*3];
         ngli_mat3_from_mat4(normal_matrix, node->modelview_matrix);
         ngli_mat3_inverse(normal_matrix, normal_matrix);
         ngli_mat3_transpose(normal_matrix, normal_matrix);
-        ngli_glUniformMatrix3fv(gl, program->normal_matrix_location_id, 1, GL_FALSE, normal_matrix);
+        ngli_uniformcache_matrix3fv(gl, uc, program->normal_matrix_location_id, normal_matrix);
+        if (s->ubo_id)
+            write_uniform_block_field(s, &s->normal_matrix_field, normal_matrix, 3 * sizeof(*normal_matrix), 3, 1);
+    }
+
+    if (s->ubo_id) {
+        write_uniform_block_field(s, &s->modelview_matrix_field, node->modelview_matrix,
+                                  4 * sizeof(*node->modelview_matrix), 4, 1);
+        write_uniform_block_field(s, &s->projection_matrix_field, node->projection_matrix,
+                                  4 * sizeof(*node->projection_matrix), 4, 1);
+
+        ngli_glBindBufferBase(gl, GL_UNIFORM_BUFFER, s->ubo_binding, s->ubo_id);
+        if (s->ubo_dirty) {
+            ngli_glBufferSubData(gl, GL_UNIFORM_BUFFER, 0, s->ubo_size, s->ubo_data);
+            s->ubo_dirty = 0;
+        }
     }
 
     return 0;
 }
 
+static void set_vertex_attrib(const struct glfunctions *gl, struct glbindings *bindings,
+                              GLuint location, const struct buffer *buffer,
+                              GLuint buffer_id, int stride, int offset)
+{
+    ngli_glEnableVertexAttribArray(gl, location);
+    ngli_glstate_bind_buffer(gl, bindings, GL_ARRAY_BUFFER, buffer_id);
+    ngli_glVertexAttribPointer(gl, location, buffer->data_comp, buffer->data_comp_type,
+                               buffer->normalized ? GL_TRUE : GL_FALSE, stride,
+                               (void *)(intptr_t)offset);
+}
+
+static void set_geometry_vertex_attrib(const struct glfunctions *gl, struct glbindings *bindings,
+                                       GLuint location, const struct geometry *geometry,
+                                       const struct ngl_node *buffer_node, int offset)
+{
+    const struct buffer *buffer = buffer_node->priv_data;
+
+    if (geometry->interleaved_buffer) {
+        const struct buffer *interleaved = geometry->interleaved_buffer->priv_data;
+        set_vertex_attrib(gl, bindings, location, buffer,
+                          interleaved->buffer_id, geometry->interleaved_stride, offset);
+    } else {
+        set_vertex_attrib(gl, bindings, location, buffer,
+                          buffer->buffer_id, buffer->data_stride, 0);
+    }
+}
+
 static int update_vertex_attribs(struct ngl_node *node)
 {
     struct ngl_ctx *ctx = node->ctx;
     struct glcontext *glcontext = ctx->glcontext;
     const struct glfunctions *gl = &glcontext->funcs;
+    struct glbindings *bindings = &ctx->glbindings;
 
     struct render *s = node->priv_data;
     struct geometry *geometry = s->geometry->priv_data;
     struct program *program = s->program->priv_data;
 
     if (geometry->vertices_buffer) {
-        struct buffer *buffer = geometry->vertices_buffer->priv_data;
         if (program->position_location_id >= 0) {
-            ngli_glEnableVertexAttribArray(gl, program->position_location_id);
-            ngli_glBindBuffer(gl, GL_ARRAY_BUFFER, buffer->buffer_id);
-            ngli_glVertexAttribPointer(gl, program->position_location_id, buffer->data_comp, GL_FLOAT, GL_FALSE, buffer->data_stride, NULL);
+            set_geometry_vertex_attrib(gl, bindings, program->position_location_id,
+                                       geometry, geometry->vertices_buffer, geometry->vertices_offset);
         }
     }
 
     if (geometry->uvcoords_buffer) {
-        struct buffer *buffer = geometry->uvcoords_buffer->priv_data;
         if (program->uvcoord_location_id >= 0) {
-            ngli_glEnableVertexAttribArray(gl, program->uvcoord_location_id);
-            ngli_glBindBuffer(gl, GL_ARRAY_BUFFER, buffer->buffer_id);
-            ngli_glVertexAttribPointer(gl, program->uvcoord_location_id, buffer->data_comp, GL_FLOAT, GL_FALSE, buffer->data_stride, NULL);
+            set_geometry_vertex_attrib(gl, bindings, program->uvcoord_location_id,
+                                       geometry, geometry->uvcoords_buffer, geometry->uvcoords_offset);
         }
     }
 
     if (geometry->normals_buffer) {
-        struct buffer *buffer = geometry->normals_buffer->priv_data;
         if (program->normal_location_id >= 0) {
-            ngli_glEnableVertexAttribArray(gl, program->normal_location_id);
-            ngli_glBindBuffer(gl, GL_ARRAY_BUFFER, buffer->buffer_id);
-            ngli_glVertexAttribPointer(gl, program->normal_location_id, buffer->data_comp, GL_FLOAT, GL_FALSE, buffer->data_stride, NULL);
+            set_geometry_vertex_attrib(gl, bindings, program->normal_location_id,
+                                       geometry, geometry->normals_buffer, geometry->normals_offset);
         }
     }
 
@@ -314,9 +472,8 @@ static int update_vertex_attribs(struct ngl_node *node)
 
             struct ngl_node *anode = entry->data;
             struct buffer *buffer = anode->priv_data;
-            ngli_glEnableVertexAttribArray(gl, s->attribute_ids[i]);
-            ngli_glBindBuffer(gl, GL_ARRAY_BUFFER, buffer->buffer_id);
-            ngli_glVertexAttribPointer(gl, s->attribute_ids[i], buffer->data_comp, GL_FLOAT, GL_FALSE, buffer->data_stride, NULL);
+            set_vertex_attrib(gl, bindings, s->attribute_ids[i], buffer,
+                              buffer->buffer_id, buffer->data_stride, 0);
             i++;
         }
     }
@@ -388,6 +545,130 @@ static int update_buffers(struct ngl_node *node)
     return 0;
 }
 
+static void get_uniform_block_field(const struct glfunctions *gl, GLuint program_id, GLuint block_index,
+                                    const char *name, struct uniformblockfield *field)
+{
+    field->offset = -1;
+
+    GLuint index = GL_INVALID_INDEX;
+    ngli_glGetUniformIndices(gl, program_id, 1, &name, &index);
+    if (index == GL_INVALID_INDEX) {
+        char array_name[128];
+        snprintf(array_name, sizeof(array_name), "%s[0]", name);
+        const char *array_namep = array_name;
+        ngli_glGetUniformIndices(gl, program_id, 1, &array_namep, &index);
+        if (index == GL_INVALID_INDEX)
+            return;
+    }
+
+    GLint uniform_block_index = -1;
+    ngli_glGetActiveUniformsiv(gl, program_id, 1, &index, GL_UNIFORM_BLOCK_INDEX, &uniform_block_index);
+    if ((GLuint)uniform_block_index != block_index)
+        return;
+
+    ngli_glGetActiveUniformsiv(gl, program_id, 1, &index, GL_UNIFORM_SIZE,          &field->size);
+    ngli_glGetActiveUniformsiv(gl, program_id, 1, &index, GL_UNIFORM_ARRAY_STRIDE,  &field->array_stride);
+    ngli_glGetActiveUniformsiv(gl, program_id, 1, &index, GL_UNIFORM_MATRIX_STRIDE, &field->matrix_stride);
+    ngli_glGetActiveUniformsiv(gl, program_id, 1, &index, GL_UNIFORM_OFFSET,        &field->offset);
+}
+
+static int init_uniform_block(struct ngl_node *node)
+{
+    struct ngl_ctx *ctx = node->ctx;
+    struct glcontext *glcontext = ctx->glcontext;
+    const struct glfunctions *gl = &glcontext->funcs;
+
+    struct render *s = node->priv_data;
+    struct program *program = s->program->priv_data;
+
+    s->modelview_matrix_field.offset  = -1;
+    s->projection_matrix_field.offset = -1;
+    s->normal_matrix_field.offset     = -1;
+
+    if (!s->uniform_block)
+        return 0;
+
+    if (!(glcontext->features & NGLI_FEATURE_UNIFORM_BUFFER_OBJECT)) {
+        LOG(ERROR, "uniform blocks are not supported by this context");
+        return -1;
+    }
+
+    const GLuint block_index = ngli_glGetUniformBlockIndex(gl, program->program_id, s->uniform_block);
+    if (block_index == GL_INVALID_INDEX) {
+        LOG(ERROR, "uniform block %s not found in program", s->uniform_block);
+        return -1;
+    }
+
+    GLint block_size = 0;
+    ngli_glGetActiveUniformBlockiv(gl, program->program_id, block_index, GL_UNIFORM_BLOCK_DATA_SIZE, &block_size);
+    ngli_glGetActiveUniformBlockiv(gl, program->program_id, block_index, GL_UNIFORM_BLOCK_BINDING, &s->ubo_binding);
+    if (block_size <= 0 || block_size > glcontext->max_uniform_block_size) {
+        LOG(ERROR, "uniform block %s size (%d) exceeds driver limit (%d)",
+            s->uniform_block, block_size, glcontext->max_uniform_block_size);
+        return -1;
+    }
+
+    s->ubo_data = calloc(1, block_size);
+    if (!s->ubo_data)
+        return -1;
+    s->ubo_size = block_size;
+
+    int nb_uniforms = s->uniforms ? ngli_hmap_count(s->uniforms) : 0;
+    if (nb_uniforms > 0) {
+        s->uniform_block_fields = calloc(nb_uniforms, sizeof(*s->uniform_block_fields));
+        if (!s->uniform_block_fields)
+            return -1;
+
+        int i = 0;
+        const struct hmap_entry *entry = NULL;
+        while ((entry = ngli_hmap_next(s->uniforms, entry))) {
+            struct uniformblockfield *field = &s->uniform_block_fields[i];
+            get_uniform_block_field(gl, program->program_id, block_index, entry->key, field);
+
+            const struct ngl_node *unode = entry->data;
+            const int is_buffer = unode->class->id == NGL_NODE_BUFFERFLOAT ||
+                                  unode->class->id == NGL_NODE_BUFFERVEC2  ||
+                                  unode->class->id == NGL_NODE_BUFFERVEC3  ||
+                                  unode->class->id == NGL_NODE_BUFFERVEC4;
+            if (field->offset >= 0 && is_buffer) {
+                const struct buffer *buffer = unode->priv_data;
+                if (buffer->count > field->size) {
+                    LOG(ERROR, "uniform buffer %s count (%d) exceeds its declared size in block %s (%d)",
+                        entry->key, buffer->count, s->uniform_block, field->size);
+                    return -1;
+                }
+            }
+            i++;
+        }
+    }
+
+    get_uniform_block_field(gl, program->program_id, block_index, "ngl_modelview_matrix",  &s->modelview_matrix_field);
+    get_uniform_block_field(gl, program->program_id, block_index, "ngl_projection_matrix", &s->projection_matrix_field);
+    get_uniform_block_field(gl, program->program_id, block_index, "ngl_normal_matrix",     &s->normal_matrix_field);
+
+    ngli_glGenBuffers(gl, 1, &s->ubo_id);
+    ngli_glBindBuffer(gl, GL_UNIFORM_BUFFER, s->ubo_id);
+    ngli_glBufferData(gl, GL_UNIFORM_BUFFER, s->ubo_size, NULL, GL_DYNAMIC_DRAW);
+    ngli_glBindBuffer(gl, GL_UNIFORM_BUFFER, 0);
+    s->ubo_dirty = 1;
+
+    return 0;
+}
+
+static int check_attribute_buffer(const struct glcontext *glcontext, const struct ngl_node *node)
+{
+    if (!node)
+        return 0;
+
+    const struct buffer *buffer = node->priv_data;
+    if ((buffer->data_comp_type == GL_HALF_FLOAT || buffer->data_comp_type == GL_HALF_FLOAT_OES) &&
+        !(glcontext->features & NGLI_FEATURE_VERTEX_HALF_FLOAT)) {
+        LOG(ERROR, "context does not support half float vertex attributes (%s)", node->name);
+        return -1;
+    }
+    return 0;
+}
+
 static int render_init(struct ngl_node *node)
 {
     int ret;
@@ -402,6 +683,12 @@ static int render_init(struct ngl_node *node)
     if (ret < 0)
         return ret;
 
+    const struct geometry *geometry = s->geometry->priv_data;
+    if (check_attribute_buffer(glcontext, geometry->vertices_buffer) < 0 ||
+        check_attribute_buffer(glcontext, geometry->uvcoords_buffer) < 0 ||
+        check_attribute_buffer(glcontext, geometry->normals_buffer) < 0)
+        return -1;
+
     if (!s->program) {
         s->program = ngl_node_create(NGL_NODE_PROGRAM);
         if (!s->program)
@@ -420,7 +707,8 @@ static int render_init(struct ngl_node *node)
     int nb_uniforms = s->uniforms ? ngli_hmap_count(s->uniforms) : 0;
     if (nb_uniforms > 0) {
         s->uniform_ids = calloc(nb_uniforms, sizeof(*s->uniform_ids));
-        if (!s->uniform_ids)
+        s->uniform_attrib_ids = calloc(nb_uniforms, sizeof(*s->uniform_attrib_ids));
+        if (!s->uniform_ids || !s->uniform_attrib_ids)
             return -1;
 
         int i = 0;
@@ -430,11 +718,16 @@ static int render_init(struct ngl_node *node)
             ret = ngli_node_init(unode);
             if (ret < 0)
                 return ret;
-            s->uniform_ids[i] = ngli_glGetUniformLocation(gl, program->program_id, entry->key);
+            s->uniform_ids[i] = ngli_programinfo_get_uniform_location(program->info, entry->key);
+            s->uniform_attrib_ids[i] = ngli_programinfo_get_attribute_location(program->info, entry->key);
             i++;
         }
     }
 
+    ret = init_uniform_block(node);
+    if (ret < 0)
+        return ret;
+
     int nb_attributes = s->attributes ? ngli_hmap_count(s->attributes) : 0;
     if (nb_attributes > 0) {
         struct geometry *geometry = s->geometry->priv_data;
@@ -451,6 +744,9 @@ static int render_init(struct ngl_node *node)
             buffer->generate_gl_buffer = 1;
 
             ret = ngli_node_init(anode);
+            if (ret < 0)
+                return ret;
+            ret = check_attribute_buffer(glcontext, anode);
             if (ret < 0)
                 return ret;
             if (buffer->count != vertices->count) {
@@ -461,7 +757,7 @@ static int render_init(struct ngl_node *node)
                     vertices->count);
                 return -1;
             }
-            s->attribute_ids[i] = ngli_glGetAttribLocation(gl, program->program_id, entry->key);
+            s->attribute_ids[i] = ngli_programinfo_get_attribute_location(program->info, entry->key);
             i++;
         }
     }
@@ -489,10 +785,10 @@ static int render_init(struct ngl_node *node)
 
             struct textureprograminfo *info = &s->textureprograminfos[i];
 
-#define GET_TEXTURE_UNIFORM_LOCATION(suffix) do {                                          \
-            char name[128];                                                                \
-            snprintf(name, sizeof(name), "%s_" #suffix, entry->key);                       \
-            info->suffix##_id = ngli_glGetUniformLocation(gl, program->program_id, name);  \
+#define GET_TEXTURE_UNIFORM_LOCATION(suffix) do {                                           \
+            char name[128];                                                                 \
+            snprintf(name, sizeof(name), "%s_" #suffix, entry->key);                        \
+            info->suffix##_id = ngli_programinfo_get_uniform_location(program->info, name); \
 } while (0)
 
             GET_TEXTURE_UNIFORM_LOCATION(sampling_mode);
@@ -543,33 +839,39 @@ static int render_init(struct ngl_node *node)
             if (ret < 0)
                 return ret;
 
-            static const GLenum props[] = {GL_BUFFER_BINDING};
-            GLsizei nb_props = 1;
-            GLint params = 0;
-            GLsizei nb_params = 1;
-            GLsizei nb_params_ret = 0;
-
-            GLuint index = ngli_glGetProgramResourceIndex(gl,
-                                                          program->program_id,
-                                                          GL_SHADER_STORAGE_BLOCK,
-                                                          entry->key);
-
-            if (index != GL_INVALID_INDEX)
-                ngli_glGetProgramResourceiv(gl,
-                                            program->program_id,
-                                            GL_SHADER_STORAGE_BLOCK,
-                                            index,
-                                            nb_props,
-                                            props,
-                                            nb_params,
-                                            &nb_params_ret,
-                                            &params);
-
-            s->buffer_ids[i] = params;
+            s->buffer_ids[i] = ngli_programinfo_get_block_binding(program->info, entry->key);
             i++;
         }
     }
 
+    if (s->indirect_buffer) {
+        if (!(glcontext->features & NGLI_FEATURE_DRAW_INDIRECT)) {
+            LOG(ERROR, "context does not support indirect draws");
+            return -1;
+        }
+
+        struct buffer *buffer = s->indirect_buffer->priv_data;
+        buffer->generate_gl_buffer = 1;
+
+        ret = ngli_node_init(s->indirect_buffer);
+        if (ret < 0)
+            return ret;
+
+        if (buffer->data_size % DRAW_ELEMENTS_INDIRECT_COMMAND_SIZE) {
+            LOG(ERROR, "indirect buffer size (%d) is not a multiple of the draw command size (%d)",
+                buffer->data_size, (int)DRAW_ELEMENTS_INDIRECT_COMMAND_SIZE);
+            return -1;
+        }
+        s->nb_indirect_draws = buffer->data_size / DRAW_ELEMENTS_INDIRECT_COMMAND_SIZE;
+
+        const struct geometry *geometry = s->geometry->priv_data;
+        const struct buffer *indices = geometry->indices_buffer->priv_data;
+        if (indices->data_comp_type == GL_UNSIGNED_BYTE) {
+            LOG(ERROR, "indirect draws do not support unsigned byte indices, "
+                "use a BufferUShort or a BufferUInt instead");
+            return -1;
+        }
+    }
 
     if (glcontext->features & NGLI_FEATURE_VERTEX_ARRAY_OBJECT) {
         ngli_glGenVertexArrays(gl, 1, &s->vao_id);
@@ -592,8 +894,18 @@ static void render_uninit(struct ngl_node *node)
         ngli_glDeleteVertexArrays(gl, 1, &s->vao_id);
     }
 
+    if (s->ubo_id)
+        ngli_glDeleteBuffers(gl, 1, &s->ubo_id);
+    free(s->ubo_data);
+    free(s->uniform_block_fields);
+
+    if (s->instance_buffer_id)
+        ngli_glDeleteBuffers(gl, 1, &s->instance_buffer_id);
+    free(s->instance_data);
+
     free(s->textureprograminfos);
     free(s->uniform_ids);
+    free(s->uniform_attrib_ids);
     free(s->attribute_ids);
     free(s->buffer_ids);
 }
@@ -637,22 +949,429 @@ static int render_update(struct ngl_node *node, double t)
         }
     }
 
+    if (s->indirect_buffer) {
+        ret = ngli_node_update(s->indirect_buffer, t);
+        if (ret < 0)
+            return ret;
+    }
+
     return ngli_node_update(s->program, t);
 }
 
+static void draw_indirect(struct ngl_node *node)
+{
+    struct ngl_ctx *ctx = node->ctx;
+    struct glcontext *glcontext = ctx->glcontext;
+    const struct glfunctions *gl = &glcontext->funcs;
+
+    const struct render *s = node->priv_data;
+    const struct geometry *geometry = s->geometry->priv_data;
+    const struct buffer *indices_buffer = geometry->indices_buffer->priv_data;
+    const struct buffer *indirect_buffer = s->indirect_buffer->priv_data;
+
+    ngli_glBindBuffer(gl, GL_DRAW_INDIRECT_BUFFER, indirect_buffer->buffer_id);
+    if (glcontext->features & NGLI_FEATURE_MULTI_DRAW_INDIRECT) {
+        ngli_glMultiDrawElementsIndirect(gl, geometry->draw_mode, indices_buffer->data_comp_type,
+                                         NULL, s->nb_indirect_draws, 0);
+    } else {
+        for (int i = 0; i < s->nb_indirect_draws; i++)
+            ngli_glDrawElementsIndirect(gl, geometry->draw_mode, indices_buffer->data_comp_type,
+                                        (void *)(intptr_t)(i * DRAW_ELEMENTS_INDIRECT_COMMAND_SIZE));
+    }
+    ngli_glBindBuffer(gl, GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+/*
+ * Test the 8 corners of the geometry bounding box in clip space: the box is
+ * outside of the frustum if all of them are on the outer side of one of the
+ * frustum planes. This is conservative: some boxes crossing the frustum
+ * corners are kept even though they are not visible.
+ */
+static int is_outside_frustum(const struct ngl_node *node)
+{
+    const struct render *s = node->priv_data;
+    const struct geometry *geometry = s->geometry->priv_data;
+
+    if (!geometry->has_bounds)
+        return 0;
+
+    NGLI_ALIGNED_MAT(mvp);
+    ngli_mat4_mul(mvp, node->projection_matrix, node->modelview_matrix);
+
+    int nb_outside[6] = {0};
+    const float *b = geometry->bounds;
+    for (int i = 0; i < 8; i++) {
+        const NGLI_ALIGNED_VEC(corner) = {b[i & 1 ? 3 : 0], b[i & 2 ? 4 : 1], b[i & 4 ? 5 : 2], 1.0f};
+        NGLI_ALIGNED_VEC(clip);
+        ngli_mat4_mul_vec4(clip, mvp, corner);
+        for (int j = 0; j < 3; j++) {
+            nb_outside[j * 2]     += clip[j] < -clip[3];
+            nb_outside[j * 2 + 1] += clip[j] >  clip[3];
+        }
+    }
+
+    for (int i = 0; i < NGLI_ARRAY_NB(nb_outside); i++)
+        if (nb_outside[i] == 8)
+            return 1;
+    return 0;
+}
+
+static int is_culled(const struct ngl_node *node)
+{
+    const struct render *s = node->priv_data;
+
+    if (!s->frustum_culling || !is_outside_frustum(node))
+        return 0;
+    node->ctx->glcontext->stats.nb_culled_draws++;
+    return 1;
+}
+
+static int same_nodedict(const struct hmap *a, const struct hmap *b)
+{
+    if (a == b)
+        return 1;
+    if (!a || !b || ngli_hmap_count(a) != ngli_hmap_count(b))
+        return 0;
+
+    const struct hmap_entry *entry = NULL;
+    while ((entry = ngli_hmap_next(a, entry)))
+        if (ngli_hmap_get(b, entry->key) != entry->data)
+            return 0;
+    return 1;
+}
+
+static int get_instance_nb_floats(int class_id)
+{
+    switch (class_id) {
+    case NGL_NODE_UNIFORMFLOAT: return 1;
+    case NGL_NODE_UNIFORMVEC2:  return 2;
+    case NGL_NODE_UNIFORMVEC3:  return 3;
+    case NGL_NODE_UNIFORMVEC4:  return 4;
+    case NGL_NODE_UNIFORMQUAT:
+    case NGL_NODE_UNIFORMMAT4:  return 16;
+    }
+    return 0;
+}
+
+/*
+ * Renders can be merged into a single instanced draw call if their program
+ * reads ngl_modelview_matrix (and ngl_normal_matrix if used) as a vertex
+ * attribute, and if they only differ by their transform and by the uniforms
+ * the program also declares as attributes. Everything else must be strictly
+ * shared.
+ */
+static int can_draw_instanced(struct ngl_node **nodes, int nb_nodes)
+{
+    const struct ngl_node *node = nodes[0];
+    const struct glcontext *glcontext = node->ctx->glcontext;
+    const struct render *s = node->priv_data;
+    const struct program *program = s->program->priv_data;
+
+    if (!(glcontext->features & NGLI_FEATURE_INSTANCED_ARRAYS) ||
+        program->modelview_matrix_attrib_id < 0 ||
+        program->normal_matrix_location_id >= 0 ||
+        s->uniform_block || s->indirect_buffer)
+        return 0;
+
+    const int nb_uniforms = s->uniforms ? ngli_hmap_count(s->uniforms) : 0;
+
+    const struct hmap_entry *entry = NULL;
+    for (int i = 0; i < nb_uniforms; i++) {
+        entry = ngli_hmap_next(s->uniforms, entry);
+        const struct ngl_node *unode = entry->data;
+        if (s->uniform_attrib_ids[i] >= 0 && !get_instance_nb_floats(unode->class->id))
+            return 0;
+    }
+
+    for (int i = 1; i < nb_nodes; i++) {
+        const struct render *si = nodes[i]->priv_data;
+        const struct program *program_i = si->program->priv_data;
+
+        if (program_i->program_id != program->program_id ||
+            ngli_geometry_compare(si->geometry, s->geometry) ||
+            si->uniform_block || si->indirect_buffer ||
+            memcmp(nodes[i]->projection_matrix, node->projection_matrix, sizeof(node->projection_matrix)) ||
+            !same_nodedict(si->textures, s->textures) ||
+            !same_nodedict(si->attributes, s->attributes) ||
+            !same_nodedict(si->buffers, s->buffers))
+            return 0;
+
+        const int nb_uniforms_i = si->uniforms ? ngli_hmap_count(si->uniforms) : 0;
+        if (nb_uniforms_i != nb_uniforms)
+            return 0;
+
+        int j = 0;
+        entry = NULL;
+        while ((entry = ngli_hmap_next(s->uniforms, entry))) {
+            const struct ngl_node *unode = entry->data;
+            const struct ngl_node *unode_i = ngli_hmap_get(si->uniforms, entry->key);
+            if (!unode_i)
+                return 0;
+            if (s->uniform_attrib_ids[j] >= 0 ? unode_i->class->id != unode->class->id
+                                              : unode_i != unode)
+                return 0;
+            j++;
+        }
+    }
+
+    return 1;
+}
+
+static int get_instance_nb_floats_total(const struct render *s)
+{
+    const struct program *program = s->program->priv_data;
+
+    int nb_floats = 16;
+    if (program->normal_matrix_attrib_id >= 0)
+        nb_floats += 9;
+
+    const struct hmap_entry *entry = NULL;
+    for (int i = 0; s->uniforms && (entry = ngli_hmap_next(s->uniforms, entry)); i++) {
+        const struct ngl_node *unode = entry->data;
+        if (s->uniform_attrib_ids[i] >= 0)
+            nb_floats += get_instance_nb_floats(unode->class->id);
+    }
+    return nb_floats;
+}
+
+static int alloc_instance_data(struct render *s, int size)
+{
+    if (size > s->instance_data_size) {
+        float *instance_data = realloc(s->instance_data, size);
+        if (!instance_data)
+            return -1;
+        s->instance_data = instance_data;
+        s->instance_data_size = size;
+    }
+    return 0;
+}
+
+/*
+ * Write the per-instance data of a node following the layout of the
+ * reference render s
+ */
+static float *write_node_instance_data(float *dst, const struct render *s, const struct ngl_node *node)
+{
+    const struct program *program = s->program->priv_data;
+    const struct render *si = node->priv_data;
+
+    memcpy(dst, node->modelview_matrix, sizeof(node->modelview_matrix));
+    dst += 16;
+
+    if (program->normal_matrix_attrib_id >= 0) {
+        ngli_mat3_from_mat4(dst, node->modelview_matrix);
+        ngli_mat3_inverse(dst, dst);
+        ngli_mat3_transpose(dst, dst);
+        dst += 9;
+    }
+
+    const struct hmap_entry *entry = NULL;
+    for (int i = 0; s->uniforms && (entry = ngli_hmap_next(s->uniforms, entry)); i++) {
+        if (s->uniform_attrib_ids[i] < 0)
+            continue;
+        const struct ngl_node *unode = ngli_hmap_get(si->uniforms, entry->key);
+        const struct uniform *u = unode->priv_data;
+        const int nb_floats = get_instance_nb_floats(unode->class->id);
+        switch (unode->class->id) {
+        case NGL_NODE_UNIFORMFLOAT: *dst = u->scalar;                                   break;
+        case NGL_NODE_UNIFORMQUAT:
+        case NGL_NODE_UNIFORMMAT4:  memcpy(dst, u->matrix, nb_floats * sizeof(*dst));  break;
+        default:                    memcpy(dst, u->vector, nb_floats * sizeof(*dst));  break;
+        }
+        dst += nb_floats;
+    }
+
+    return dst;
+}
+
+static int write_instance_data(struct ngl_node **nodes, int nb_nodes, int *stridep, int *nb_instancesp)
+{
+    struct render *s = nodes[0]->priv_data;
+
+    const int stride = get_instance_nb_floats_total(s);
+    if (alloc_instance_data(s, nb_nodes * stride * sizeof(*s->instance_data)) < 0)
+        return -1;
+
+    int nb_instances = 0;
+    float *dst = s->instance_data;
+    for (int n = 0; n < nb_nodes; n++) {
+        const struct ngl_node *node = nodes[n];
+
+        if (is_culled(node))
+            continue;
+        nb_instances++;
+
+        dst = write_node_instance_data(dst, s, node);
+    }
+
+    *stridep = stride * sizeof(*s->instance_data);
+    *nb_instancesp = nb_instances;
+    return 0;
+}
+
+enum {
+    INSTANCE_ATTRIB_DISABLE,
+    INSTANCE_ATTRIB_ENABLE,
+    INSTANCE_ATTRIB_CONSTANT,
+};
+
+static void set_instance_attrib(const struct glfunctions *gl, GLint location, int nb_floats,
+                                int stride, int offset, int mode, const float *data)
+{
+    if (location < 0 || !nb_floats)
+        return;
+
+    /* matrices are split into one attribute per column */
+    const int nb_cols = nb_floats == 16 ? 4 : nb_floats == 9 ? 3 : 1;
+    const int nb_comp = nb_floats / nb_cols;
+    for (int i = 0; i < nb_cols; i++) {
+        if (mode == INSTANCE_ATTRIB_ENABLE) {
+            ngli_glEnableVertexAttribArray(gl, location + i);
+            ngli_glVertexAttribPointer(gl, location + i, nb_comp, GL_FLOAT, GL_FALSE, stride,
+                                       (void *)(intptr_t)(offset + i * nb_comp * sizeof(float)));
+            ngli_glVertexAttribDivisor(gl, location + i, 1);
+        } else if (mode == INSTANCE_ATTRIB_DISABLE) {
+            ngli_glVertexAttribDivisor(gl, location + i, 0);
+            ngli_glDisableVertexAttribArray(gl, location + i);
+        } else {
+            float value[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+            memcpy(value, data + offset / sizeof(float) + i * nb_comp, nb_comp * sizeof(*value));
+            ngli_glVertexAttrib4fv(gl, location + i, value);
+        }
+    }
+}
+
+static void set_instance_attribs(struct ngl_node *node, int stride, int mode)
+{
+    struct ngl_ctx *ctx = node->ctx;
+    struct glcontext *glcontext = ctx->glcontext;
+    const struct glfunctions *gl = &glcontext->funcs;
+
+    struct render *s = node->priv_data;
+    const struct program *program = s->program->priv_data;
+    const float *data = s->instance_data;
+
+    int offset = 0;
+    set_instance_attrib(gl, program->modelview_matrix_attrib_id, 16, stride, offset, mode, data);
+    offset += 16 * sizeof(float);
+
+    if (program->normal_matrix_attrib_id >= 0) {
+        set_instance_attrib(gl, program->normal_matrix_attrib_id, 9, stride, offset, mode, data);
+        offset += 9 * sizeof(float);
+    }
+
+    const struct hmap_entry *entry = NULL;
+    for (int i = 0; s->uniforms && (entry = ngli_hmap_next(s->uniforms, entry)); i++) {
+        if (s->uniform_attrib_ids[i] < 0)
+            continue;
+        const struct ngl_node *unode = entry->data;
+        const int nb_floats = get_instance_nb_floats(unode->class->id);
+        set_instance_attrib(gl, s->uniform_attrib_ids[i], nb_floats, stride, offset, mode, data);
+        offset += nb_floats * sizeof(float);
+    }
+}
+
+static int has_instance_attribs(const struct render *s)
+{
+    const struct program *program = s->program->priv_data;
+
+    if (program->modelview_matrix_attrib_id >= 0 || program->normal_matrix_attrib_id >= 0)
+        return 1;
+
+    const int nb_uniforms = s->uniforms ? ngli_hmap_count(s->uniforms) : 0;
+    for (int i = 0; i < nb_uniforms; i++)
+        if (s->uniform_attrib_ids[i] >= 0)
+            return 1;
+    return 0;
+}
+
+/*
+ * Programs reading the transforms and uniforms from per-instance attributes
+ * still need them when drawn outside of an instanced draw call: they are
+ * then set as constant attribute values.
+ */
+static void set_constant_instance_attribs(struct ngl_node *node)
+{
+    struct render *s = node->priv_data;
+
+    const int stride = get_instance_nb_floats_total(s);
+    if (alloc_instance_data(s, stride * sizeof(*s->instance_data)) < 0) {
+        LOG(ERROR, "could not allocate the instance data of %s", node->name);
+        return;
+    }
+
+    write_node_instance_data(s->instance_data, s, node);
+    set_instance_attribs(node, stride * sizeof(*s->instance_data), INSTANCE_ATTRIB_CONSTANT);
+}
+
 static void render_draw(struct ngl_node *node)
 {
     struct ngl_ctx *ctx = node->ctx;
     struct glcontext *glcontext = ctx->glcontext;
     const struct glfunctions *gl = &glcontext->funcs;
+    struct glbindings *bindings = &ctx->glbindings;
 
     struct render *s = node->priv_data;
 
+    if (is_culled(node))
+        return;
+
     const struct program *program = s->program->priv_data;
-    ngli_glUseProgram(gl, program->program_id);
+    ngli_glstate_use_program(gl, bindings, program->program_id);
 
     if (glcontext->features & NGLI_FEATURE_VERTEX_ARRAY_OBJECT) {
-        ngli_glBindVertexArray(gl, s->vao_id);
+        ngli_glstate_bind_vertex_array(gl, bindings, s->vao_id);
+    } else {
+        update_vertex_attribs(node);
+    }
+
+    update_uniforms(node);
+    update_buffers(node);
+
+    if (has_instance_attribs(s))
+        set_constant_instance_attribs(node);
+
+    const struct geometry *geometry = s->geometry->priv_data;
+    const struct buffer *indices_buffer = geometry->indices_buffer->priv_data;
+
+    ngli_glstate_bind_buffer(gl, bindings, GL_ELEMENT_ARRAY_BUFFER, indices_buffer->buffer_id);
+    if (s->indirect_buffer)
+        draw_indirect(node);
+    else
+        ngli_glDrawElements(gl, geometry->draw_mode, indices_buffer->count, indices_buffer->data_comp_type, 0);
+
+    if (!(glcontext->features & NGLI_FEATURE_VERTEX_ARRAY_OBJECT)) {
+        disable_vertex_attribs(node);
+    }
+}
+
+void ngli_render_draw_instanced(struct ngl_node **nodes, int nb_nodes)
+{
+    int stride, nb_instances;
+
+    if (!can_draw_instanced(nodes, nb_nodes) ||
+        write_instance_data(nodes, nb_nodes, &stride, &nb_instances) < 0) {
+        for (int i = 0; i < nb_nodes; i++)
+            render_draw(nodes[i]);
+        return;
+    }
+
+    if (!nb_instances)
+        return;
+
+    struct ngl_node *node = nodes[0];
+    struct ngl_ctx *ctx = node->ctx;
+    struct glcontext *glcontext = ctx->glcontext;
+    const struct glfunctions *gl = &glcontext->funcs;
+    struct glbindings *bindings = &ctx->glbindings;
+
+    struct render *s = node->priv_data;
+
+    const struct program *program = s->program->priv_data;
+    ngli_glstate_use_program(gl, bindings, program->program_id);
+
+    if (glcontext->features & NGLI_FEATURE_VERTEX_ARRAY_OBJECT) {
+        ngli_glstate_bind_vertex_array(gl, bindings, s->vao_id);
     } else {
         update_vertex_attribs(node);
     }
@@ -660,11 +1379,19 @@ static void render_draw(struct ngl_node *node)
     update_uniforms(node);
     update_buffers(node);
 
+    if (!s->instance_buffer_id)
+        ngli_glGenBuffers(gl, 1, &s->instance_buffer_id);
+    ngli_glstate_bind_buffer(gl, bindings, GL_ARRAY_BUFFER, s->instance_buffer_id);
+    ngli_glBufferData(gl, GL_ARRAY_BUFFER, nb_instances * stride, s->instance_data, GL_STREAM_DRAW);
+    set_instance_attribs(node, stride, INSTANCE_ATTRIB_ENABLE);
+
     const struct geometry *geometry = s->geometry->priv_data;
     const struct buffer *indices_buffer = geometry->indices_buffer->priv_data;
 
-    ngli_glBindBuffer(gl, GL_ELEMENT_ARRAY_BUFFER, indices_buffer->buffer_id);
-    ngli_glDrawElements(gl, geometry->draw_mode, indices_buffer->count, indices_buffer->data_comp_type, 0);
+    ngli_glstate_bind_buffer(gl, bindings, GL_ELEMENT_ARRAY_BUFFER, indices_buffer->buffer_id);
+    ngli_glDrawElementsInstanced(gl, geometry->draw_mode, indices_buffer->count, indices_buffer->data_comp_type, 0, nb_instances);
+
+    set_instance_attribs(node, stride, INSTANCE_ATTRIB_DISABLE);
 
     if (!(glcontext->features & NGLI_FEATURE_VERTEX_ARRAY_OBJECT)) {
         disable_vertex_attribs(node);
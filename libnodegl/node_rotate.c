@@ -30,7 +30,7 @@
 
 #define OFFSET(x) offsetof(struct rotate, x)
 static const struct node_param rotate_params[] = {
-    {"child", PARAM_TYPE_NODE, OFFSET(child), .flags=PARAM_FLAG_CONSTRUCTOR,
+    {"child", PARAM_TYPE_NODE, OFFSET(child), .flags=PARAM_FLAG_CONSTRUCTOR|PARAM_FLAG_DRAW_CHILD,
               .desc=NGLI_DOCSTRING("scene to rotate")},
     {"angle",  PARAM_TYPE_DBL,  OFFSET(angle),
                .desc=NGLI_DOCSTRING("rotation angle in degrees")},
@@ -127,18 +127,11 @@ static int rotate_update(struct ngl_node *node, double t)
     return ngli_node_update(child, t);
 }
 
-static void rotate_draw(struct ngl_node *node)
-{
-    struct rotate *s = node->priv_data;
-    ngli_node_draw(s->child);
-}
-
 const struct node_class ngli_rotate_class = {
     .id        = NGL_NODE_ROTATE,
     .name      = "Rotate",
     .init      = rotate_init,
     .update    = rotate_update,
-    .draw      = rotate_draw,
     .priv_size = sizeof(struct rotate),
     .params    = rotate_params,
     .file      = __FILE__,
@@ -29,7 +29,7 @@
 
 #define OFFSET(x) offsetof(struct rtt, x)
 static const struct node_param rtt_params[] = {
-    {"child",         PARAM_TYPE_NODE, OFFSET(child),   .flags=PARAM_FLAG_CONSTRUCTOR},
+    {"child",         PARAM_TYPE_NODE, OFFSET(child),   .flags=PARAM_FLAG_CONSTRUCTOR|PARAM_FLAG_DRAW_CHILD},
     {"color_texture", PARAM_TYPE_NODE, OFFSET(color_texture), .flags=PARAM_FLAG_CONSTRUCTOR,
                       .node_types=(const int[]){NGL_NODE_TEXTURE2D, -1}},
     {"depth_texture", PARAM_TYPE_NODE, OFFSET(depth_texture), .flags=PARAM_FLAG_DOT_DISPLAY_FIELDNAME,
@@ -59,11 +59,11 @@ static int rtt_prefetch(struct ngl_node *node)
         }
     }
 
-    GLuint framebuffer_id = 0;
-    ngli_glGetIntegerv(gl, GL_FRAMEBUFFER_BINDING, (GLint *)&framebuffer_id);
+    struct glbindings *bindings = &ctx->glbindings;
+    const GLuint framebuffer_id = ngli_glstate_get_framebuffer(gl, bindings, GL_FRAMEBUFFER);
 
     ngli_glGenFramebuffers(gl, 1, &s->framebuffer_id);
-    ngli_glBindFramebuffer(gl, GL_FRAMEBUFFER, s->framebuffer_id);
+    ngli_glstate_bind_framebuffer(gl, bindings, GL_FRAMEBUFFER, s->framebuffer_id);
 
     LOG(VERBOSE, "init rtt with texture %d", texture->id);
     ngli_glFramebufferTexture2D(gl, GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture->id, 0);
@@ -83,7 +83,7 @@ static int rtt_prefetch(struct ngl_node *node)
         return -1;
     }
 
-    ngli_glBindFramebuffer(gl, GL_FRAMEBUFFER, framebuffer_id);
+    ngli_glstate_bind_framebuffer(gl, bindings, GL_FRAMEBUFFER, framebuffer_id);
 
     /* flip vertically the color and depth textures so the coordinates match
      * how the uv coordinates system works */
@@ -107,32 +107,42 @@ static int rtt_update(struct ngl_node *node, double t)
     return ngli_node_update(s->color_texture, t);
 }
 
-static void rtt_draw(struct ngl_node *node)
+static int rtt_pre_draw(struct ngl_node *node)
 {
     struct ngl_ctx *ctx = node->ctx;
     struct glcontext *glcontext = ctx->glcontext;
     const struct glfunctions *gl = &glcontext->funcs;
 
-    GLint viewport[4];
     struct rtt *s = node->priv_data;
 
-    GLuint framebuffer_id = 0;
-    ngli_glGetIntegerv(gl, GL_FRAMEBUFFER_BINDING, (GLint *)&framebuffer_id);
-    ngli_glBindFramebuffer(gl, GL_FRAMEBUFFER, s->framebuffer_id);
+    struct glbindings *bindings = &ctx->glbindings;
+    s->prev_framebuffer_id = ngli_glstate_get_framebuffer(gl, bindings, GL_FRAMEBUFFER);
+    ngli_glstate_bind_framebuffer(gl, bindings, GL_FRAMEBUFFER, s->framebuffer_id);
 
-    ngli_glGetIntegerv(gl, GL_VIEWPORT, viewport);
-    ngli_glViewport(gl, 0, 0, s->width, s->height);
+    const GLint viewport[4] = {0, 0, s->width, s->height};
+    ngli_glstate_get_viewport(gl, bindings, s->prev_viewport);
+    ngli_glstate_viewport(gl, bindings, viewport);
     ngli_glClear(gl, GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    ngli_node_draw(s->child);
+    return 1;
+}
+
+static void rtt_post_draw(struct ngl_node *node)
+{
+    struct ngl_ctx *ctx = node->ctx;
+    struct glcontext *glcontext = ctx->glcontext;
+    const struct glfunctions *gl = &glcontext->funcs;
+
+    struct rtt *s = node->priv_data;
 
     if (ngli_glCheckFramebufferStatus(gl, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
         LOG(ERROR, "framebuffer %u is not complete", s->framebuffer_id);
         return;
     }
 
-    ngli_glBindFramebuffer(gl, GL_FRAMEBUFFER, framebuffer_id);
-    ngli_glViewport(gl, viewport[0], viewport[1], viewport[2], viewport[3]);
+    struct glbindings *bindings = &ctx->glbindings;
+    ngli_glstate_bind_framebuffer(gl, bindings, GL_FRAMEBUFFER, s->prev_framebuffer_id);
+    ngli_glstate_viewport(gl, bindings, s->prev_viewport);
 
     struct texture *texture = s->color_texture->priv_data;
     switch(texture->min_filter) {
@@ -140,7 +150,7 @@ static void rtt_draw(struct ngl_node *node)
     case GL_NEAREST_MIPMAP_LINEAR:
     case GL_LINEAR_MIPMAP_NEAREST:
     case GL_LINEAR_MIPMAP_LINEAR:
-        ngli_glBindTexture(gl, GL_TEXTURE_2D, texture->id);
+        ngli_glstate_bind_texture(gl, bindings, GL_TEXTURE_2D, texture->id);
         ngli_glGenerateMipmap(gl, GL_TEXTURE_2D);
         break;
     }
@@ -164,15 +174,15 @@ static void rtt_release(struct ngl_node *node)
 
     struct rtt *s = node->priv_data;
 
-    GLuint framebuffer_id = 0;
-    ngli_glGetIntegerv(gl, GL_FRAMEBUFFER_BINDING, (GLint *)&framebuffer_id);
-    ngli_glBindFramebuffer(gl, GL_FRAMEBUFFER, s->framebuffer_id);
+    struct glbindings *bindings = &ctx->glbindings;
+    const GLuint framebuffer_id = ngli_glstate_get_framebuffer(gl, bindings, GL_FRAMEBUFFER);
+    ngli_glstate_bind_framebuffer(gl, bindings, GL_FRAMEBUFFER, s->framebuffer_id);
     ngli_glFramebufferTexture2D(gl, GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
     ngli_glFramebufferRenderbuffer(gl, GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, 0);
 
     ngli_glDeleteRenderbuffers(gl, 1, &s->renderbuffer_id);
     ngli_glDeleteFramebuffers(gl, 1, &s->framebuffer_id);
-    ngli_glBindFramebuffer(gl, GL_FRAMEBUFFER, framebuffer_id);
+    ngli_glstate_bind_framebuffer(gl, bindings, GL_FRAMEBUFFER, framebuffer_id);
 }
 
 const struct node_class ngli_rtt_class = {
@@ -180,7 +190,8 @@ const struct node_class ngli_rtt_class = {
     .name      = "RenderToTexture",
     .prefetch  = rtt_prefetch,
     .update    = rtt_update,
-    .draw      = rtt_draw,
+    .pre_draw  = rtt_pre_draw,
+    .post_draw = rtt_post_draw,
     .release   = rtt_release,
     .priv_size = sizeof(struct rtt),
     .params    = rtt_params,
@@ -29,7 +29,7 @@
 
 #define OFFSET(x) offsetof(struct scale, x)
 static const struct node_param scale_params[] = {
-    {"child",   PARAM_TYPE_NODE, OFFSET(child), .flags=PARAM_FLAG_CONSTRUCTOR,
+    {"child",   PARAM_TYPE_NODE, OFFSET(child), .flags=PARAM_FLAG_CONSTRUCTOR|PARAM_FLAG_DRAW_CHILD,
                 .desc=NGLI_DOCSTRING("scene to scale")},
     {"factors", PARAM_TYPE_VEC3, OFFSET(factors),
                 .desc=NGLI_DOCSTRING("scaling factors (how much to scale on each axis)")},
@@ -91,17 +91,10 @@ static int scale_update(struct ngl_node *node, double t)
     return ngli_node_update(child, t);
 }
 
-static void scale_draw(struct ngl_node *node)
-{
-    struct scale *s = node->priv_data;
-    ngli_node_draw(s->child);
-}
-
 const struct node_class ngli_scale_class = {
     .id        = NGL_NODE_SCALE,
     .name      = "Scale",
     .update    = scale_update,
-    .draw      = scale_draw,
     .priv_size = sizeof(struct scale),
     .params    = scale_params,
     .file      = __FILE__,
@@ -309,25 +309,71 @@ static void tex_image(const struct glfunctions *gl, const struct texture *s,
     }
 }
 
-static void tex_sub_image(const struct glfunctions *gl, const struct texture *s,
+static int64_t tex_image_size(const struct texture *s)
+{
+    const int width = s->upload_row_length ? s->upload_row_length : s->width;
+    const int depth = s->local_target == GL_TEXTURE_3D ? s->depth : 1;
+    return ngli_gl_image_size(s->format, s->type, width, s->height, depth);
+}
+
+/*
+ * Copy the data into the next pixel buffer object of the ring and return the
+ * pointer to pass to glTexSubImage*() instead of the client data: NULL,
+ * meaning offset 0 in the bound unpack buffer. The storage is orphaned before
+ * being mapped so the driver can hand over a fresh block instead of waiting
+ * for the transfer of the previous frames to complete.
+ */
+static const uint8_t *stream_to_pbo(const struct glfunctions *gl, struct texture *s,
+                                    const uint8_t *data)
+{
+    const int64_t size = tex_image_size(s);
+    GLuint *pbo = &s->upload_pbos[s->upload_pbo_index];
+
+    s->upload_pbo_index = (s->upload_pbo_index + 1) % NGLI_ARRAY_NB(s->upload_pbos);
+
+    if (!*pbo)
+        ngli_glGenBuffers(gl, 1, pbo);
+    ngli_glBindBuffer(gl, GL_PIXEL_UNPACK_BUFFER, *pbo);
+    ngli_glBufferData(gl, GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW);
+
+    void *dst = ngli_glMapBufferRange(gl, GL_PIXEL_UNPACK_BUFFER, 0, size,
+                                      GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    if (!dst) {
+        LOG(WARNING, "could not map pixel buffer object, falling back on a direct upload");
+        ngli_glBindBuffer(gl, GL_PIXEL_UNPACK_BUFFER, 0);
+        return data;
+    }
+
+    memcpy(dst, data, size);
+    ngli_glUnmapBuffer(gl, GL_PIXEL_UNPACK_BUFFER);
+
+    return NULL;
+}
+
+static void tex_sub_image(const struct glfunctions *gl, struct texture *s,
                           const uint8_t *data)
 {
+    const uint8_t *pixels = s->stream_uploads ? stream_to_pbo(gl, s, data) : data;
+
     switch (s->local_target) {
         case GL_TEXTURE_2D:
             if (s->width && s->height)
                 ngli_glTexSubImage2D(gl, GL_TEXTURE_2D, 0,
                                      0, 0, /* x/y offsets */
                                      s->width, s->height,
-                                     s->format, s->type, data);
+                                     s->format, s->type, pixels);
             break;
         case GL_TEXTURE_3D:
             if (s->width && s->height && s->depth)
                 ngli_glTexSubImage3D(gl, GL_TEXTURE_3D, 0,
                                      0, 0, 0, /* x/y/z offsets */
                                      s->width, s->height, s->depth,
-                                     s->format, s->type, data);
+                                     s->format, s->type, pixels);
             break;
     }
+
+    if (!pixels)
+        ngli_glBindBuffer(gl, GL_PIXEL_UNPACK_BUFFER, 0);
 }
 
 static void tex_storage(const struct glfunctions *gl, const struct texture *s,
@@ -359,7 +405,9 @@ int ngli_texture_update_local_texture(struct ngl_node *node,
 {
     struct ngl_ctx *ctx = node->ctx;
     struct glcontext *glcontext = ctx->glcontext;
-    const struct glfunctions *gl = &glcontext->funcs;
+    const struct glfunctions *gl = node->async_prefetch == ASYNC_PREFETCH_PENDING
+                                 ? ngli_prefetcher_get_glfunctions(ctx->prefetcher)
+                                 : &glcontext->funcs;
 
     struct texture *s = node->priv_data;
     int ret = 0;
@@ -373,6 +421,9 @@ int ngli_texture_update_local_texture(struct ngl_node *node,
     s->height = height;
     s->depth = depth;
 
+    if (s->upload_row_length)
+        ngli_glPixelStorei(gl, GL_UNPACK_ROW_LENGTH, s->upload_row_length);
+
     if (s->immutable) {
         if (update_dimensions) {
             ret = 1;
@@ -414,6 +465,9 @@ int ngli_texture_update_local_texture(struct ngl_node *node,
         }
     }
 
+    if (s->upload_row_length)
+        ngli_glPixelStorei(gl, GL_UNPACK_ROW_LENGTH, 0);
+
     switch (s->min_filter) {
     case GL_NEAREST_MIPMAP_NEAREST:
     case GL_NEAREST_MIPMAP_LINEAR:
@@ -430,6 +484,21 @@ int ngli_texture_update_local_texture(struct ngl_node *node,
     return ret;
 }
 
+static int is_streamed_data_src(const struct ngl_node *data_src)
+{
+    switch (data_src->class->id) {
+    case NGL_NODE_FPS:
+    case NGL_NODE_MEDIA:
+    case NGL_NODE_ANIMATEDBUFFERFLOAT:
+    case NGL_NODE_ANIMATEDBUFFERVEC2:
+    case NGL_NODE_ANIMATEDBUFFERVEC3:
+    case NGL_NODE_ANIMATEDBUFFERVEC4:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
 static int texture_prefetch(struct ngl_node *node, GLenum local_target)
 {
     struct ngl_ctx *ctx = node->ctx;
@@ -537,6 +606,11 @@ static int texture_prefetch(struct ngl_node *node, GLenum local_target)
         default:
             ngli_assert(0);
         }
+
+        /* Sources changing over time are streamed through a ring of pixel
+         * buffer objects instead of being copied synchronously by the driver */
+        s->stream_uploads = is_streamed_data_src(s->data_src) &&
+                            (glcontext->features & NGLI_FEATURE_PIXEL_BUFFER_OBJECT);
     }
 
     ngli_texture_update_local_texture(node, s->width, s->height, s->depth, data);
@@ -589,17 +663,10 @@ static void handle_buffer_frame(struct ngl_node *node)
     ngli_texture_update_local_texture(node, s->width, s->height, s->depth, data);
 }
 
-static int texture_update(struct ngl_node *node, double t)
+static void upload_data_src_frame(struct ngl_node *node)
 {
     struct texture *s = node->priv_data;
 
-    if (!s->data_src)
-        return 0;
-
-    int ret = ngli_node_update(s->data_src, t);
-    if (ret < 0)
-        return ret;
-
     switch (s->data_src->class->id) {
         case NGL_NODE_FPS:
             handle_fps_frame(node);
@@ -611,13 +678,28 @@ static int texture_update(struct ngl_node *node, double t)
         case NGL_NODE_ANIMATEDBUFFERVEC2:
         case NGL_NODE_ANIMATEDBUFFERVEC3:
         case NGL_NODE_ANIMATEDBUFFERVEC4:
-            ret = ngli_node_update(s->data_src, t);
-            if (ret < 0)
-                return ret;
             handle_buffer_frame(node);
             break;
     }
+}
+
+static int texture_update(struct ngl_node *node, double t)
+{
+    struct texture *s = node->priv_data;
+
+    if (!s->data_src)
+        return 0;
 
+    int ret = ngli_node_update(s->data_src, t);
+    if (ret < 0)
+        return ret;
+
+    /* The upload requires the GL context which is only available on the
+     * rendering thread */
+    if (node->ctx->parallel_update)
+        return ngli_node_defer_update(node, upload_data_src_frame);
+
+    upload_data_src_frame(node);
     return 0;
 }
 
@@ -633,6 +715,10 @@ static void texture_release(struct ngl_node *node)
 
     ngli_glDeleteTextures(gl, 1, &s->local_id);
     s->id = s->local_id = 0;
+
+    ngli_glDeleteBuffers(gl, NGLI_ARRAY_NB(s->upload_pbos), s->upload_pbos);
+    memset(s->upload_pbos, 0, sizeof(s->upload_pbos));
+    s->upload_pbo_index = 0;
 }
 
 static int texture3d_init(struct ngl_node *node)
@@ -650,6 +736,7 @@ static int texture3d_init(struct ngl_node *node)
 const struct node_class ngli_texture2d_class = {
     .id        = NGL_NODE_TEXTURE2D,
     .name      = "Texture2D",
+    .flags     = NODE_FLAG_ASYNC_PREFETCH,
     .prefetch  = texture2d_prefetch,
     .update    = texture_update,
     .release   = texture_release,
@@ -661,6 +748,7 @@ const struct node_class ngli_texture2d_class = {
 const struct node_class ngli_texture3d_class = {
     .id        = NGL_NODE_TEXTURE3D,
     .name      = "Texture3D",
+    .flags     = NODE_FLAG_ASYNC_PREFETCH,
     .init      = texture3d_init,
     .prefetch  = texture3d_prefetch,
     .update    = texture_update,
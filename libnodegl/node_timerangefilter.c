@@ -45,7 +45,7 @@ struct timerangefilter {
 
 #define OFFSET(x) offsetof(struct timerangefilter, x)
 static const struct node_param timerangefilter_params[] = {
-    {"child", PARAM_TYPE_NODE, OFFSET(child), .flags=PARAM_FLAG_CONSTRUCTOR,
+    {"child", PARAM_TYPE_NODE, OFFSET(child), .flags=PARAM_FLAG_CONSTRUCTOR|PARAM_FLAG_DRAW_CHILD,
               .desc=NGLI_DOCSTRING("time filtered scene")},
     {"ranges", PARAM_TYPE_NODELIST, OFFSET(ranges),
                .node_types=RANGES_TYPES_LIST,
@@ -202,7 +202,6 @@ static int timerangefilter_update(struct ngl_node *node, double t)
             if (rro->updated)
                 return 0;
             t = rro->render_time;
-            rro->updated = 1;
         }
     }
 
@@ -212,28 +211,40 @@ static int timerangefilter_update(struct ngl_node *node, double t)
     memcpy(child->modelview_matrix, node->modelview_matrix, sizeof(node->modelview_matrix));
     memcpy(child->projection_matrix, node->projection_matrix, sizeof(node->projection_matrix));
 
-    return ngli_node_update(child, t);
+    int ret = ngli_node_update(child, t);
+    if (ret < 0)
+        return ret;
+
+    /* Only flagged once the update went through so that an interrupted
+     * parallel update can be resumed */
+    if (rr_id >= 0 && s->ranges[rr_id]->class->id == NGL_NODE_TIMERANGEMODEONCE) {
+        struct timerangemode *rro = s->ranges[rr_id]->priv_data;
+        rro->updated = 1;
+    }
+
+    return 0;
 }
 
-static void timerangefilter_draw(struct ngl_node *node)
+static int timerangefilter_pre_draw(struct ngl_node *node)
 {
     struct timerangefilter *s = node->priv_data;
 
     if (!s->drawme) {
         LOG(VERBOSE, "%s @ %p not marked for drawing, skip it", node->name, node);
-        return;
+        return 0;
     }
 
-    ngli_node_draw(s->child);
+    return 1;
 }
 
 const struct node_class ngli_timerangefilter_class = {
     .id        = NGL_NODE_TIMERANGEFILTER,
     .name      = "TimeRangeFilter",
+    .flags     = NODE_FLAG_TIME_DEPENDENT,
     .init      = timerangefilter_init,
     .visit     = timerangefilter_visit,
     .update    = timerangefilter_update,
-    .draw      = timerangefilter_draw,
+    .pre_draw  = timerangefilter_pre_draw,
     .priv_size = sizeof(struct timerangefilter),
     .params    = timerangefilter_params,
     .file      = __FILE__,
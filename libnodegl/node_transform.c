@@ -29,7 +29,7 @@
 
 #define OFFSET(x) offsetof(struct transform, x)
 static const struct node_param transform_params[] = {
-    {"child",  PARAM_TYPE_NODE, OFFSET(child), .flags=PARAM_FLAG_CONSTRUCTOR,
+    {"child",  PARAM_TYPE_NODE, OFFSET(child), .flags=PARAM_FLAG_CONSTRUCTOR|PARAM_FLAG_DRAW_CHILD,
                .desc=NGLI_DOCSTRING("scene to apply the transform to")},
     {"matrix", PARAM_TYPE_MAT4, OFFSET(matrix), {.mat=NGLI_MAT4_IDENTITY},
                .desc=NGLI_DOCSTRING("transformation matrix")},
@@ -46,17 +46,10 @@ static int transform_update(struct ngl_node *node, double t)
     return ngli_node_update(child, t);
 }
 
-static void transform_draw(struct ngl_node *node)
-{
-    struct transform *s = node->priv_data;
-    ngli_node_draw(s->child);
-}
-
 const struct node_class ngli_transform_class = {
     .id        = NGL_NODE_TRANSFORM,
     .name      = "Transform",
     .update    = transform_update,
-    .draw      = transform_draw,
     .priv_size = sizeof(struct transform),
     .params    = transform_params,
     .file      = __FILE__,
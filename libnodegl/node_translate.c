@@ -29,7 +29,7 @@
 
 #define OFFSET(x) offsetof(struct translate, x)
 static const struct node_param translate_params[] = {
-    {"child",  PARAM_TYPE_NODE, OFFSET(child), .flags=PARAM_FLAG_CONSTRUCTOR,
+    {"child",  PARAM_TYPE_NODE, OFFSET(child), .flags=PARAM_FLAG_CONSTRUCTOR|PARAM_FLAG_DRAW_CHILD,
                .desc=NGLI_DOCSTRING("scene to translate")},
     {"vector", PARAM_TYPE_VEC3, OFFSET(vector),
                .desc=NGLI_DOCSTRING("translation vector")},
@@ -67,17 +67,10 @@ static int translate_update(struct ngl_node *node, double t)
     return ngli_node_update(child, t);
 }
 
-static void translate_draw(struct ngl_node *node)
-{
-    struct translate *s = node->priv_data;
-    ngli_node_draw(s->child);
-}
-
 const struct node_class ngli_translate_class = {
     .id        = NGL_NODE_TRANSLATE,
     .name      = "Translate",
     .update    = translate_update,
-    .draw      = translate_draw,
     .priv_size = sizeof(struct translate),
     .params    = translate_params,
     .file      = __FILE__,
@@ -31,12 +31,12 @@
 
 #define OFFSET(x) offsetof(struct geometry, x)
 static const struct node_param triangle_params[] = {
-    {"edge0", PARAM_TYPE_VEC3, OFFSET(triangle_edges[0]), .flags=PARAM_FLAG_CONSTRUCTOR},
-    {"edge1", PARAM_TYPE_VEC3, OFFSET(triangle_edges[3]), .flags=PARAM_FLAG_CONSTRUCTOR},
-    {"edge2", PARAM_TYPE_VEC3, OFFSET(triangle_edges[6]), .flags=PARAM_FLAG_CONSTRUCTOR},
-    {"uv_edge0", PARAM_TYPE_VEC2, OFFSET(triangle_uvs[0]), {.vec={0.0f, 0.0f}}},
-    {"uv_edge1", PARAM_TYPE_VEC2, OFFSET(triangle_uvs[2]), {.vec={0.0f, 1.0f}}},
-    {"uv_edge2", PARAM_TYPE_VEC2, OFFSET(triangle_uvs[4]), {.vec={1.0f, 1.0f}}},
+    {"edge0", PARAM_TYPE_VEC3, OFFSET(triangle_edges[0]), .flags=PARAM_FLAG_CONSTRUCTOR|PARAM_FLAG_DRAW_ORDER},
+    {"edge1", PARAM_TYPE_VEC3, OFFSET(triangle_edges[3]), .flags=PARAM_FLAG_CONSTRUCTOR|PARAM_FLAG_DRAW_ORDER},
+    {"edge2", PARAM_TYPE_VEC3, OFFSET(triangle_edges[6]), .flags=PARAM_FLAG_CONSTRUCTOR|PARAM_FLAG_DRAW_ORDER},
+    {"uv_edge0", PARAM_TYPE_VEC2, OFFSET(triangle_uvs[0]), {.vec={0.0f, 0.0f}}, .flags=PARAM_FLAG_DRAW_ORDER},
+    {"uv_edge1", PARAM_TYPE_VEC2, OFFSET(triangle_uvs[2]), {.vec={0.0f, 1.0f}}, .flags=PARAM_FLAG_DRAW_ORDER},
+    {"uv_edge2", PARAM_TYPE_VEC2, OFFSET(triangle_uvs[4]), {.vec={1.0f, 1.0f}}, .flags=PARAM_FLAG_DRAW_ORDER},
     {NULL}
 };
 
@@ -46,19 +46,19 @@ static int triangle_init(struct ngl_node *node)
 {
     struct geometry *s = node->priv_data;
 
-    s->vertices_buffer = ngli_geometry_generate_buffer(node->ctx,
-                                                       NGL_NODE_BUFFERVEC3,
-                                                       NB_VERTICES,
-                                                       sizeof(s->triangle_edges),
-                                                       s->triangle_edges);
+    s->vertices_buffer = ngli_geometry_get_shared_attribute_buffer(node->ctx,
+                                                                   NGL_NODE_BUFFERVEC3,
+                                                                   NB_VERTICES,
+                                                                   sizeof(s->triangle_edges),
+                                                                   s->triangle_edges);
     if (!s->vertices_buffer)
         return -1;
 
-    s->uvcoords_buffer = ngli_geometry_generate_buffer(node->ctx,
-                                                       NGL_NODE_BUFFERVEC2,
-                                                       NB_VERTICES,
-                                                       sizeof(s->triangle_uvs),
-                                                       s->triangle_uvs);
+    s->uvcoords_buffer = ngli_geometry_get_shared_attribute_buffer(node->ctx,
+                                                                   NGL_NODE_BUFFERVEC2,
+                                                                   NB_VERTICES,
+                                                                   sizeof(s->triangle_uvs),
+                                                                   s->triangle_uvs);
     if (!s->uvcoords_buffer)
         return -1;
 
@@ -71,39 +71,35 @@ static int triangle_init(struct ngl_node *node)
     for (int i = 1; i < NB_VERTICES; i++)
         memcpy(normals + (i * 3), normals, 3 * sizeof(*normals));
 
-    s->normals_buffer = ngli_geometry_generate_buffer(node->ctx,
-                                                      NGL_NODE_BUFFERVEC3,
-                                                      NB_VERTICES,
-                                                      sizeof(normals),
-                                                      normals);
+    s->normals_buffer = ngli_geometry_get_shared_attribute_buffer(node->ctx,
+                                                                  NGL_NODE_BUFFERVEC3,
+                                                                  NB_VERTICES,
+                                                                  sizeof(normals),
+                                                                  normals);
     if (!s->normals_buffer)
         return -1;
 
-    s->indices_buffer = ngli_geometry_generate_indices_buffer(node->ctx,
-                                                              NB_VERTICES);
+    s->indices_buffer = ngli_geometry_get_shared_indices_buffer(node->ctx,
+                                                                NB_VERTICES);
     if (!s->indices_buffer)
         return -1;
 
     s->draw_mode = GL_TRIANGLES;
 
-    return 0;
-}
+    ngli_geometry_compute_bounds(node);
 
-#define NODE_UNREFP(node) do {                    \
-    if (node) {                                   \
-        ngli_node_detach_ctx(node);               \
-        ngl_node_unrefp(&node);                   \
-    }                                             \
-} while (0)
+    return ngli_geometry_init_interleaved_buffer(node);
+}
 
 static void triangle_uninit(struct ngl_node *node)
 {
     struct geometry *s = node->priv_data;
 
-    NODE_UNREFP(s->vertices_buffer);
-    NODE_UNREFP(s->uvcoords_buffer);
-    NODE_UNREFP(s->normals_buffer);
-    NODE_UNREFP(s->indices_buffer);
+    ngli_geometry_release_shared_buffer(&s->vertices_buffer);
+    ngli_geometry_release_shared_buffer(&s->uvcoords_buffer);
+    ngli_geometry_release_shared_buffer(&s->normals_buffer);
+    ngli_geometry_release_shared_buffer(&s->indices_buffer);
+    ngli_geometry_release_shared_buffer(&s->interleaved_buffer);
 }
 
 const struct node_class ngli_triangle_class = {
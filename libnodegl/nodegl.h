@@ -63,6 +63,8 @@ typedef void (*ngl_log_callback_type)(void *arg, int level, const char *filename
 /**
  * Set a global custom logging callback.
  *
+ * It can be overridden for a given context with ngl_set_log_callback().
+ *
  * @param arg       opaque user argument to be forwarded to the callback
  *                  (typically a user context)
  * @param callback  callback function to be called when logging a message
@@ -128,6 +130,10 @@ struct ngl_node;
 #define NGL_NODE_BUFFERUSVEC2           NGLI_FOURCC('B','u','s','2')
 #define NGL_NODE_BUFFERUSVEC3           NGLI_FOURCC('B','u','s','3')
 #define NGL_NODE_BUFFERUSVEC4           NGLI_FOURCC('B','u','s','4')
+#define NGL_NODE_BUFFERHALFFLOAT        NGLI_FOURCC('B','h','v','1')
+#define NGL_NODE_BUFFERHVEC2            NGLI_FOURCC('B','h','v','2')
+#define NGL_NODE_BUFFERHVEC3            NGLI_FOURCC('B','h','v','3')
+#define NGL_NODE_BUFFERHVEC4            NGLI_FOURCC('B','h','v','4')
 #define NGL_NODE_BUFFERFLOAT            NGLI_FOURCC('B','f','v','1')
 #define NGL_NODE_BUFFERVEC2             NGLI_FOURCC('B','f','v','2')
 #define NGL_NODE_BUFFERVEC3             NGLI_FOURCC('B','f','v','3')
@@ -186,7 +192,8 @@ struct ngl_node *ngl_node_create(int type, ...);
 /**
  * Increment the reference counter of a given node by 1.
  *
- * This function is NOT thread-safe.
+ * The reference counting is atomic, so a node can be referenced and
+ * unreferenced from different threads.
  *
  * This function does not perform any OpenGL operation.
  *
@@ -290,6 +297,12 @@ enum {
 
 /**
  * Opaque structure identifying a node.gl context
+ *
+ * Independent contexts can be used concurrently, typically one per thread,
+ * each with its own OpenGL context current on that thread. A given context
+ * must not be used from several threads at the same time, and a node can only
+ * be part of the scene of one context at a time: attaching it to a second one
+ * makes ngl_set_scene() fail.
  */
 struct ngl_ctx;
 
@@ -333,6 +346,139 @@ struct ngl_ctx *ngl_create(void);
  */
 int ngl_set_glcontext(struct ngl_ctx *s, void *display, void *window, void *handle, int platform, int api);
 
+/**
+ * Set a custom logging callback for the messages related to this context.
+ *
+ * The messages emitted while executing the functions of this context (and its
+ * internal threads) are sent to this callback instead of the global one set
+ * with ngl_log_set_callback(). A NULL callback restores the global one.
+ *
+ * @param s         pointer to the node.gl context
+ * @param arg       opaque user argument to be forwarded to the callback
+ * @param callback  callback function to be called when logging a message
+ *
+ * @return 0 on success, < 0 on error
+ */
+int ngl_set_log_callback(struct ngl_ctx *s, void *arg, ngl_log_callback_type callback);
+
+/**
+ * Set the minimum logging level for the messages related to this context.
+ *
+ * @param s      pointer to the node.gl context
+ * @param level  log level (any of NGL_LOG_*), or a negative value to use the
+ *               global one set with ngl_log_set_min_level()
+ *
+ * @return 0 on success, < 0 on error
+ */
+int ngl_set_log_min_level(struct ngl_ctx *s, int level);
+
+/**
+ * Set the number of threads used to update the scene.
+ *
+ * The children of Group nodes which do not share any node are updated in
+ * parallel. The OpenGL operations are still executed on the calling thread.
+ *
+ * By default, the update is done on the calling thread only.
+ *
+ * @param s          pointer to the node.gl context
+ * @param nb_threads number of threads (including the calling one), 0 or 1 to
+ *                   disable the parallel update
+ *
+ * @return 0 on success, < 0 on error
+ */
+int ngl_set_update_threads(struct ngl_ctx *s, int nb_threads);
+
+/**
+ * Enable or disable the asynchronous prefetch of the resources.
+ *
+ * When enabled, the textures and medias entering their prefetch time range are
+ * prepared on a separate thread using an OpenGL context shared with the one
+ * set by ngl_set_glcontext(), so their upload does not stall the rendering.
+ *
+ * This function must be called before ngl_set_scene().
+ *
+ * @param s      pointer to the node.gl context
+ * @param enable 1 to enable the asynchronous prefetch, 0 to disable it
+ *
+ * @return 0 on success, < 0 on error
+ */
+int ngl_set_async_prefetch(struct ngl_ctx *s, int enable);
+
+/**
+ * Set a directory where the linked shader programs are cached.
+ *
+ * The programs are stored in their driver specific binary form (when the
+ * driver supports it) and reloaded from there on the next runs instead of
+ * being compiled again. Binaries produced by another driver, or rejected by
+ * the current one, are ignored and replaced. The directory must exist.
+ *
+ * This function must be called before ngl_set_scene().
+ *
+ * @param s     pointer to the node.gl context
+ * @param path  path to the cache directory, or NULL to disable the cache
+ *
+ * @return 0 on success, < 0 on error
+ */
+int ngl_set_program_cache_dir(struct ngl_ctx *s, const char *path);
+
+/**
+ * Enable or disable the tracing of the scene operations.
+ *
+ * When enabled, the duration of every init, prefetch, update, draw and release
+ * of the nodes, as well as the duration of each ngl_draw() call, is recorded
+ * in a ring buffer keeping the most recent events.
+ *
+ * This function must be called before ngl_set_scene().
+ *
+ * @param s          pointer to the node.gl context
+ * @param nb_events  maximum number of events kept, 0 to disable the tracing
+ *
+ * @return 0 on success, < 0 on error
+ */
+int ngl_set_tracing(struct ngl_ctx *s, int nb_events);
+
+/**
+ * Dump the recorded trace events in the Chrome trace_event JSON format
+ * (loadable in chrome://tracing).
+ *
+ * Must be destroyed using free().
+ *
+ * @param s  pointer to the node.gl context
+ *
+ * @return an allocated JSON string or NULL on error
+ */
+char *ngl_dump_trace(struct ngl_ctx *s);
+
+/**
+ * Statistics of the OpenGL operations executed during a frame
+ */
+struct ngl_frame_stats {
+    int nb_draw_calls;              /* glDrawElements() calls */
+    int nb_dispatch_calls;          /* glDispatchCompute() calls */
+    int nb_program_switches;        /* glUseProgram() calls */
+    int nb_texture_binds;           /* glBindTexture() calls */
+    int nb_uniform_uploads;         /* glUniform*() calls */
+    int nb_buffer_uploads;          /* glBufferData() (with data) and glBufferSubData() calls */
+    int64_t buffer_upload_bytes;    /* bytes uploaded by the buffer uploads */
+    int nb_texture_uploads;         /* glTexImage*() (with data) and glTexSubImage*() calls */
+    int64_t texture_upload_bytes;   /* bytes uploaded by the texture uploads */
+    int64_t readback_bytes;         /* bytes read back from the framebuffer (Camera pipe) */
+    int nb_culled_draws;            /* Render draws skipped by the frustum culling */
+};
+
+/**
+ * Get the statistics of the last frame drawn with ngl_draw().
+ *
+ * The operations executed asynchronously by the prefetcher (see
+ * ngl_set_async_prefetch()) are not accounted reliably.
+ *
+ * @param s      pointer to the node.gl context
+ * @param stats  pointer to the structure to fill
+ *
+ * @return 0 on success, < 0 on error
+ */
+int ngl_get_frame_stats(struct ngl_ctx *s, struct ngl_frame_stats *stats);
+
 /**
  * Associate a scene with a node.gl context.
  *
@@ -19,6 +19,7 @@
  * under the License.
  */
 
+#include <pthread.h>
 #include <stdarg.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -53,14 +54,16 @@ static void *aligned_allocz(size_t size)
 
 #define ALIGN(v, a) ((v) + (((v) + (a) - 1) & ~((v) - 1)))
 
-static struct ngl_node *node_create(const struct node_class *class)
+static struct ngl_node *node_create(const struct node_class *class, struct arena *arena)
 {
     struct ngl_node *node;
     const size_t node_size = ALIGN(sizeof(*node), NGLI_ALIGN);
 
-    node = aligned_allocz(node_size + class->priv_size);
+    node = arena ? ngli_arena_alloc(arena, node_size + class->priv_size)
+                 : aligned_allocz(node_size + class->priv_size);
     if (!node)
         return NULL;
+    node->arena_allocated = !!arena;
     node->priv_data = ((uint8_t *)node) + node_size;
 
     /* Make sure the node and its private data are properly aligned */
@@ -81,6 +84,7 @@ static struct ngl_node *node_create(const struct node_class *class)
     node->refcount = 1;
 
     node->state = STATE_UNINITIALIZED;
+    node->children_dirty = 1;
 
     node->modelview_matrix[ 0] =
     node->modelview_matrix[ 5] =
@@ -97,16 +101,6 @@ static struct ngl_node *node_create(const struct node_class *class)
 
 #define DEF_NAME_CHR(c) (((c) >= 'A' && (c) <= 'Z') ? (c) ^ 0x20 : (c))
 
-char *ngli_node_default_name(const char *class_name)
-{
-    char *name = ngli_strdup(class_name);
-    if (!name)
-        return NULL;
-    for (int i = 0; name[i]; i++)
-        name[i] = DEF_NAME_CHR(name[i]);
-    return name;
-}
-
 int ngli_is_default_name(const char *class_name, const char *str)
 {
     const size_t len = strlen(class_name);
@@ -133,31 +127,86 @@ static const struct node_class *get_node_class(int type)
     return NULL;
 }
 
-struct ngl_node *ngli_node_create_noconstructor(int type)
+/*
+ * Default node names are shared between all the nodes of the same class
+ * instead of being allocated for each node.
+ */
+#define DEFAULT_NAME_INDEX(type_name, class) DEFAULT_NAME_##class,
+enum {
+    NODE_MAP_TYPE2CLASS(DEFAULT_NAME_INDEX)
+    NB_DEFAULT_NAMES
+};
+
+static char default_names[NB_DEFAULT_NAMES][32];
+static pthread_once_t default_names_once = PTHREAD_ONCE_INIT;
+
+static void init_default_name(char *dst, size_t dst_size, const char *class_name)
+{
+    ngli_assert(strlen(class_name) < dst_size);
+    for (int i = 0; class_name[i]; i++)
+        dst[i] = DEF_NAME_CHR(class_name[i]);
+}
+
+#define INIT_DEFAULT_NAME(type_name, class) do {                            \
+    extern const struct node_class class;                                   \
+    init_default_name(default_names[DEFAULT_NAME_##class],                  \
+                      sizeof(default_names[0]), class.name);                \
+} while (0);
+
+static void init_default_names(void)
+{
+    NODE_MAP_TYPE2CLASS(INIT_DEFAULT_NAME)
+}
+
+#define GET_DEFAULT_NAME(type_name, class)                                  \
+    case type_name: return default_names[DEFAULT_NAME_##class];
+
+static char *get_default_name(int type)
+{
+    pthread_once(&default_names_once, init_default_names);
+    switch (type) {
+        NODE_MAP_TYPE2CLASS(GET_DEFAULT_NAME)
+    }
+    return NULL;
+}
+
+static int has_default_name(const struct ngl_node *node)
+{
+    return node->name && node->name == get_default_name(node->class->id);
+}
+
+int ngli_node_unshare_name(struct ngl_node *node)
+{
+    if (has_default_name(node)) {
+        char *name = ngli_strdup(node->name);
+        if (!name)
+            return -1;
+        node->name = name;
+    }
+    return 0;
+}
+
+struct ngl_node *ngli_node_create_noconstructor(struct arena *arena, int type)
 {
     const struct node_class *class = get_node_class(type);
     if (!class)
         return NULL;
 
-    struct ngl_node *node = node_create(class);
+    struct ngl_node *node = node_create(class, arena);
     if (!node)
         return NULL;
 
     ngli_params_set_defaults((uint8_t *)node, ngli_base_node_params);
     ngli_params_set_defaults(node->priv_data, node->class->params);
 
-    node->name = ngli_node_default_name(node->class->name);
-    if (!node->name) {
-        ngl_node_unrefp(&node);
-        return NULL;
-    }
+    node->name = get_default_name(type);
 
     return node;
 }
 
 struct ngl_node *ngl_node_create(int type, ...)
 {
-    struct ngl_node *node = ngli_node_create_noconstructor(type);
+    struct ngl_node *node = ngli_node_create_noconstructor(NULL, type);
     if (!node)
         return NULL;
 
@@ -171,21 +220,31 @@ struct ngl_node *ngl_node_create(int type, ...)
     return node;
 }
 
+static int node_prefetch(struct ngl_node *node);
+
 static void node_release(struct ngl_node *node)
 {
     if (node->state == STATE_IDLE)
         return;
 
+    /* The resources of an ongoing asynchronous prefetch still need a release */
+    if (node->async_prefetch != ASYNC_PREFETCH_NONE)
+        node_prefetch(node);
+
     if (node->state != STATE_READY)
         return;
 
     ngli_assert(node->ctx);
     if (node->class->release) {
         LOG(DEBUG, "RELEASE %s @ %p", node->name, node);
+        struct tracer *tracer = node->ctx->tracer;
+        const int64_t trace_start = ngli_trace_start(tracer);
         node->class->release(node);
+        ngli_trace_end(tracer, "release", node->name, node->class->name, trace_start);
     }
     node->state = STATE_IDLE;
     node->last_update_time = -1.;
+    node->update_generation = 0;
 }
 
 /*
@@ -222,82 +281,173 @@ static void node_uninit(struct ngl_node *node)
     }
     reset_non_params(node);
     node->state = STATE_UNINITIALIZED;
+    node->update_generation = 0;
 }
 
-static int node_set_children_ctx(uint8_t *base_ptr, const struct node_param *params,
-                                 struct ngl_ctx *ctx)
+static int count_children(uint8_t *base_ptr, const struct node_param *params)
 {
+    int nb_children = 0;
+
     if (!params)
         return 0;
     for (int i = 0; params[i].key; i++) {
         const struct node_param *par = &params[i];
 
         if (par->type == PARAM_TYPE_NODE) {
-            uint8_t *node_p = base_ptr + par->offset;
-            struct ngl_node *node = *(struct ngl_node **)node_p;
-            if (node) {
-                int ret = ngli_node_attach_ctx(node, ctx);
-                if (ret < 0)
-                    return ret;
-            }
+            if (*(struct ngl_node **)(base_ptr + par->offset))
+                nb_children++;
+        } else if (par->type == PARAM_TYPE_NODELIST) {
+            uint8_t *nb_elems_p = base_ptr + par->offset + sizeof(struct ngl_node **);
+            nb_children += *(int *)nb_elems_p;
+        } else if (par->type == PARAM_TYPE_NODEDICT) {
+            struct hmap *hmap = *(struct hmap **)(base_ptr + par->offset);
+            if (hmap)
+                nb_children += ngli_hmap_count(hmap);
+        }
+    }
+    return nb_children;
+}
+
+static int fill_children(struct ngl_node **children, uint8_t *base_ptr,
+                         const struct node_param *params)
+{
+    int n = 0;
+
+    if (!params)
+        return 0;
+    for (int i = 0; params[i].key; i++) {
+        const struct node_param *par = &params[i];
+
+        if (par->type == PARAM_TYPE_NODE) {
+            struct ngl_node *node = *(struct ngl_node **)(base_ptr + par->offset);
+            if (node)
+                children[n++] = node;
         } else if (par->type == PARAM_TYPE_NODELIST) {
             uint8_t *elems_p = base_ptr + par->offset;
             uint8_t *nb_elems_p = base_ptr + par->offset + sizeof(struct ngl_node **);
             struct ngl_node **elems = *(struct ngl_node ***)elems_p;
             const int nb_elems = *(int *)nb_elems_p;
-            for (int j = 0; j < nb_elems; j++) {
-                int ret = ngli_node_attach_ctx(elems[j], ctx);
-                if (ret < 0)
-                    return ret;
-            }
+            for (int j = 0; j < nb_elems; j++)
+                children[n++] = elems[j];
         } else if (par->type == PARAM_TYPE_NODEDICT) {
             struct hmap *hmap = *(struct hmap **)(base_ptr + par->offset);
             if (!hmap)
                 continue;
             const struct hmap_entry *entry = NULL;
-            while ((entry = ngli_hmap_next(hmap, entry))) {
-                struct ngl_node *node = entry->data;
-                int ret = ngli_node_attach_ctx(node, ctx);
-                if (ret < 0)
-                    return ret;
-            }
+            while ((entry = ngli_hmap_next(hmap, entry)))
+                children[n++] = entry->data;
         }
     }
+    return n;
+}
+
+/*
+ * Flatten all the node parameters (Node, NodeList and NodeDict) into a
+ * contiguous array of children so the graph traversals do not need to go
+ * through the parameters reflection. The array is invalidated every time a
+ * parameter is changed.
+ */
+static int node_build_children(struct ngl_node *node)
+{
+    if (!node->children_dirty)
+        return 0;
+
+    const int nb_children = count_children(node->priv_data, node->class->params)
+                          + count_children((uint8_t *)node, ngli_base_node_params);
+
+    free(node->children);
+    node->children = NULL;
+    node->nb_children = 0;
+
+    if (nb_children) {
+        node->children = malloc(nb_children * sizeof(*node->children));
+        if (!node->children)
+            return -1;
+        int n = fill_children(node->children, node->priv_data, node->class->params);
+        n += fill_children(node->children + n, (uint8_t *)node, ngli_base_node_params);
+        ngli_assert(n == nb_children);
+        node->nb_children = nb_children;
+    }
+
+    node->children_dirty = 0;
     return 0;
 }
 
-static int node_set_ctx(struct ngl_node *node, struct ngl_ctx *ctx)
+static int node_set_ctx(struct ngl_node *node, struct ngl_ctx *ctx, uint64_t attach_id)
 {
     int ret;
 
     if (ctx) {
-        if (node->ctx) {
-            if (node->ctx != ctx) {
-                LOG(ERROR, "\"%s\" is associated with another rendering context", node->name);
-                return -1;
-            }
-        } else {
-            node->ctx = ctx;
+        /*
+         * Contexts can be attached from different threads, so the ownership
+         * of the node is taken atomically.
+         */
+        struct ngl_ctx *cur_ctx = NULL;
+        if (__atomic_compare_exchange_n(&node->ctx, &cur_ctx, ctx, 0,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            node->attach_id = attach_id;
+        } else if (cur_ctx != ctx) {
+            LOG(ERROR, "\"%s\" is associated with another rendering context", node->name);
+            return -1;
         }
     } else {
         node_uninit(node);
-        node->ctx = NULL;
+
+        /*
+         * The cached classifications of the subtree rely on the parameters
+         * generation of the context, which does not track the changes made
+         * while the node is detached.
+         */
+        node->time_dependent_generation = 0;
+        node->parallel_update_generation = 0;
+
+        __atomic_store_n(&node->ctx, NULL, __ATOMIC_RELEASE);
     }
 
-    if ((ret = node_set_children_ctx(node->priv_data, node->class->params, ctx)) < 0 ||
-        (ret = node_set_children_ctx((uint8_t *)node, ngli_base_node_params, ctx)) < 0)
+    ret = node_build_children(node);
+    if (ret < 0)
         return ret;
+
+    for (int i = 0; i < node->nb_children; i++) {
+        ret = node_set_ctx(node->children[i], ctx, attach_id);
+        if (ret < 0)
+            return ret;
+    }
     return 0;
 }
 
+/*
+ * Detach the nodes taken by a failed attach, leaving untouched the ones
+ * which were already associated with the context before it.
+ */
+static void node_rollback_ctx(struct ngl_node *node, struct ngl_ctx *ctx, uint64_t attach_id)
+{
+    if (__atomic_load_n(&node->ctx, __ATOMIC_ACQUIRE) != ctx)
+        return;
+
+    if (node_build_children(node) >= 0)
+        for (int i = 0; i < node->nb_children; i++)
+            node_rollback_ctx(node->children[i], ctx, attach_id);
+
+    if (node->attach_id == attach_id) {
+        node_uninit(node);
+        node->attach_id = 0;
+        __atomic_store_n(&node->ctx, NULL, __ATOMIC_RELEASE);
+    }
+}
+
 int ngli_node_attach_ctx(struct ngl_node *node, struct ngl_ctx *ctx)
 {
-    return node_set_ctx(node, ctx);
+    const uint64_t attach_id = ++ctx->walk_id;
+    int ret = node_set_ctx(node, ctx, attach_id);
+    if (ret < 0)
+        node_rollback_ctx(node, ctx, attach_id);
+    return ret;
 }
 
 void ngli_node_detach_ctx(struct ngl_node *node)
 {
-    int ret = node_set_ctx(node, NULL);
+    int ret = node_set_ctx(node, NULL, 0);
     ngli_assert(ret == 0);
 }
 
@@ -312,7 +462,17 @@ int ngli_node_init(struct ngl_node *node)
     ngli_assert(node->ctx);
     if (node->class->init) {
         LOG(VERBOSE, "INIT %s @ %p", node->name, node);
+        struct tracer *tracer = node->ctx->tracer;
+        const int64_t trace_start = ngli_trace_start(tracer);
         int ret = node->class->init(node);
+        ngli_trace_end(tracer, "init", node->name, node->class->name, trace_start);
+
+        /*
+         * The init may set node parameters internally (such as the default
+         * program of a Render), so the children cache must be rebuilt.
+         */
+        node->children_dirty = 1;
+
         if (ret < 0)
             return ret;
     }
@@ -369,47 +529,14 @@ int ngli_node_visit(struct ngl_node *node, int is_active, double t)
     if (node->class->visit)
         return node->class->visit(node, is_active, t);
 
-    uint8_t *base_ptr = node->priv_data;
-    const struct node_param *par = node->class->params;
+    ret = node_build_children(node);
+    if (ret < 0)
+        return ret;
 
-    while (par && par->key) {
-        switch (par->type) {
-            case PARAM_TYPE_NODE: {
-                uint8_t *child_p = base_ptr + par->offset;
-                struct ngl_node *child = *(struct ngl_node **)child_p;
-                if (child) {
-                    ret = ngli_node_visit(child, is_active, t);
-                    if (ret < 0)
-                        return ret;
-                }
-                break;
-            }
-            case PARAM_TYPE_NODELIST: {
-                uint8_t *elems_p = base_ptr + par->offset;
-                uint8_t *nb_elems_p = base_ptr + par->offset + sizeof(struct ngl_node **);
-                struct ngl_node **elems = *(struct ngl_node ***)elems_p;
-                const int nb_elems = *(int *)nb_elems_p;
-                for (int i = 0; i < nb_elems; i++) {
-                    ret = ngli_node_visit(elems[i], is_active, t);
-                    if (ret < 0)
-                        return ret;
-                }
-                break;
-            }
-            case PARAM_TYPE_NODEDICT: {
-                struct hmap *hmap = *(struct hmap **)(base_ptr + par->offset);
-                if (!hmap)
-                    break;
-                const struct hmap_entry *entry = NULL;
-                while ((entry = ngli_hmap_next(hmap, entry))) {
-                    ret = ngli_node_visit(entry->data, is_active, t);
-                    if (ret < 0)
-                        return ret;
-                }
-                break;
-            }
-        }
-        par++;
+    for (int i = 0; i < node->nb_children; i++) {
+        ret = ngli_node_visit(node->children[i], is_active, t);
+        if (ret < 0)
+            return ret;
     }
 
     return 0;
@@ -424,9 +551,16 @@ static int node_prefetch(struct ngl_node *node)
     if (ret < 0)
         return ret;
 
-    if (node->class->prefetch) {
+    if (node->async_prefetch != ASYNC_PREFETCH_NONE) {
+        ret = ngli_prefetcher_wait(node->ctx->prefetcher, node);
+        if (ret < 0)
+            return ret;
+    } else if (node->class->prefetch) {
         LOG(DEBUG, "PREFETCH %s @ %p", node->name, node);
+        struct tracer *tracer = node->ctx->tracer;
+        const int64_t trace_start = ngli_trace_start(tracer);
         ret = node->class->prefetch(node);
+        ngli_trace_end(tracer, "prefetch", node->name, node->class->name, trace_start);
         if (ret < 0)
             return ret;
     }
@@ -435,68 +569,121 @@ static int node_prefetch(struct ngl_node *node)
     return 0;
 }
 
-int ngli_node_honor_release_prefetch(struct ngl_node *node, double t)
+static int node_prefetch_async(struct ngl_node *node)
 {
-    uint8_t *base_ptr = node->priv_data;
-    const struct node_param *par = node->class->params;
+    if (node->state == STATE_READY)
+        return 0;
+
+    struct prefetcher *prefetcher = node->ctx->prefetcher;
+    if (node->async_prefetch != ASYNC_PREFETCH_NONE) {
+        if (ngli_prefetcher_is_done(prefetcher, node))
+            return node_prefetch(node);
+        return 0;
+    }
+
+    int ret = ngli_node_init(node);
+    if (ret < 0)
+        return ret;
+
+    LOG(DEBUG, "SUBMIT PREFETCH %s @ %p", node->name, node);
+    ret = ngli_prefetcher_submit(prefetcher, node);
+    if (ret < 0)
+        return node_prefetch(node);
+
+    return 0;
+}
 
+int ngli_node_honor_release_prefetch(struct ngl_node *node, double t)
+{
     if (node->visit_time != t)
         return 0;
 
-    while (par && par->key) {
-        switch (par->type) {
-            case PARAM_TYPE_NODE: {
-                uint8_t *child_p = base_ptr + par->offset;
-                struct ngl_node *child = *(struct ngl_node **)child_p;
-                if (child) {
-                    int ret = ngli_node_honor_release_prefetch(child, t);
-                    if (ret < 0)
-                        return ret;
-                }
-                break;
-            }
-            case PARAM_TYPE_NODELIST: {
-                uint8_t *elems_p = base_ptr + par->offset;
-                uint8_t *nb_elems_p = base_ptr + par->offset + sizeof(struct ngl_node **);
-                struct ngl_node **elems = *(struct ngl_node ***)elems_p;
-                const int nb_elems = *(int *)nb_elems_p;
-                for (int i = 0; i < nb_elems; i++) {
-                    int ret = ngli_node_honor_release_prefetch(elems[i], t);
-                    if (ret < 0)
-                        return ret;
-                }
-                break;
-            }
-            case PARAM_TYPE_NODEDICT: {
-                struct hmap *hmap = *(struct hmap **)(base_ptr + par->offset);
-                if (!hmap)
-                    break;
-                const struct hmap_entry *entry = NULL;
-                while ((entry = ngli_hmap_next(hmap, entry))) {
-                    int ret = ngli_node_honor_release_prefetch(entry->data, t);
-                    if (ret < 0)
-                        return ret;
-                }
-                break;
-            }
-        }
-        par++;
+    int ret = node_build_children(node);
+    if (ret < 0)
+        return ret;
+
+    for (int i = 0; i < node->nb_children; i++) {
+        ret = ngli_node_honor_release_prefetch(node->children[i], t);
+        if (ret < 0)
+            return ret;
     }
 
-    if (node->is_active)
+    if (node->is_active) {
+        if (node->ctx->prefetcher && (node->class->flags & NODE_FLAG_ASYNC_PREFETCH))
+            return node_prefetch_async(node);
         return node_prefetch(node);
+    }
 
     node_release(node);
     return 0;
 }
 
+/*
+ * A node is time dependent if its class is (animations, medias, ...) or if
+ * any node below it is. The classification only depends on the parameters so
+ * it is cached until a parameter is changed within the rendering context.
+ */
+static int node_is_time_dependent(struct ngl_node *node)
+{
+    const uint64_t generation = node->ctx->params_generation;
+
+    if (node->time_dependent_generation == generation)
+        return node->time_dependent;
+
+    int time_dependent = node->class->flags & NODE_FLAG_TIME_DEPENDENT;
+    if (!time_dependent && node_build_children(node) < 0)
+        time_dependent = 1;
+    for (int i = 0; !time_dependent && i < node->nb_children; i++)
+        time_dependent = node_is_time_dependent(node->children[i]);
+
+    node->time_dependent = !!time_dependent;
+    node->time_dependent_generation = generation;
+    return node->time_dependent;
+}
+
+/*
+ * The update of a time invariant subtree can be skipped as long as no
+ * parameter changed and the parent did not provide new matrices since its
+ * last update.
+ */
+static int node_can_skip_update(struct ngl_node *node)
+{
+    return node->update_generation == node->ctx->params_generation &&
+           !node_is_time_dependent(node) &&
+           !memcmp(node->update_modelview_matrix, node->modelview_matrix, sizeof(node->modelview_matrix)) &&
+           !memcmp(node->update_projection_matrix, node->projection_matrix, sizeof(node->projection_matrix));
+}
+
+/*
+ * Whether the update of the node is going to init or prefetch it late. The
+ * nodes without an update callback (such as the internal ones) are only
+ * initialized.
+ */
+static int node_update_needs_gl(struct ngl_node *node, double t)
+{
+    if (node->state == STATE_UNINITIALIZED)
+        return 1;
+    return node->class->update && node->state != STATE_READY &&
+           node->last_update_time != t && !node_can_skip_update(node);
+}
+
 int ngli_node_update(struct ngl_node *node, double t)
 {
+    /* A late init or prefetch requires the GL context which the update
+     * workers do not have: interrupt the parallel update so that it gets
+     * resumed on the rendering thread */
+    if (node->ctx->parallel_update && node_update_needs_gl(node, t)) {
+        __atomic_store_n(&node->ctx->parallel_update_interrupted, 1, __ATOMIC_RELAXED);
+        return -1;
+    }
+
     int ret = ngli_node_init(node);
     if (ret < 0)
         return ret;
     if (node->class->update) {
-        if (node->last_update_time != t) {
+        if (node_can_skip_update(node)) {
+            LOG(VERBOSE, "%s is time invariant, skip update for t=%g", node->name, t);
+        } else if (node->last_update_time != t) {
             // Sometimes the node might not be prefetched by the node_check_prefetch()
             // crawling: this could happen when the node was for instance instantiated
             // internally and not through the options. So just to be safe, we
@@ -506,9 +693,16 @@ int ngli_node_update(struct ngl_node *node, double t)
                 return ret;
 
             LOG(VERBOSE, "UPDATE %s @ %p with t=%g", node->name, node, t);
+            struct tracer *tracer = node->ctx->tracer;
+            const int64_t trace_start = ngli_trace_start(tracer);
             ret = node->class->update(node, t);
+            ngli_trace_end(tracer, "update", node->name, node->class->name, trace_start);
             if (ret < 0)
                 return ret;
+
+            node->update_generation = node->ctx->params_generation;
+            memcpy(node->update_modelview_matrix, node->modelview_matrix, sizeof(node->modelview_matrix));
+            memcpy(node->update_projection_matrix, node->projection_matrix, sizeof(node->projection_matrix));
         } else {
             LOG(VERBOSE, "%s already updated for t=%g, skip it", node->name, t);
         }
@@ -518,12 +712,176 @@ int ngli_node_update(struct ngl_node *node, double t)
     return 0;
 }
 
+/*
+ * Stamp the whole subtree with the owner identifier. Fails if one of the
+ * nodes is already owned by another subtree within the same walk.
+ */
+static int mark_subtree_owner(struct ngl_node *node, uint64_t walk_id, int owner)
+{
+    if (node->walk_id == walk_id)
+        return node->walk_owner == owner ? 0 : -1;
+
+    node->walk_id = walk_id;
+    node->walk_owner = owner;
+
+    int ret = node_build_children(node);
+    if (ret < 0)
+        return ret;
+
+    for (int i = 0; i < node->nb_children; i++) {
+        ret = mark_subtree_owner(node->children[i], walk_id, owner);
+        if (ret < 0)
+            return ret;
+    }
+    return 0;
+}
+
+/*
+ * The children can only be updated concurrently if they do not share any
+ * node, otherwise two threads could update the same node simultaneously.
+ */
+static int can_update_in_parallel(struct ngl_node *node, struct ngl_node **children, int nb_children)
+{
+    struct ngl_ctx *ctx = node->ctx;
+
+    if (node->parallel_update_generation == ctx->params_generation)
+        return node->parallel_update_capable;
+
+    const uint64_t walk_id = ++ctx->walk_id;
+    int capable = 1;
+    for (int i = 0; capable && i < nb_children; i++)
+        if (mark_subtree_owner(children[i], walk_id, i) < 0)
+            capable = 0;
+
+    LOG(DEBUG, "children of %s can%s be updated in parallel", node->name, capable ? "" : "not");
+    node->parallel_update_capable = capable;
+    node->parallel_update_generation = ctx->params_generation;
+    return capable;
+}
+
+struct parallel_update {
+    struct ngl_node **children;
+    double t;
+};
+
+static int update_child_job(void *arg, int job_id)
+{
+    struct parallel_update *pu = arg;
+    struct ngl_node *child = pu->children[job_id];
+    const struct log_ctx *prev_log_ctx = ngli_log_set_thread_ctx(&child->ctx->log_ctx);
+    int ret = ngli_node_update(child, pu->t);
+    ngli_log_set_thread_ctx(prev_log_ctx);
+    return ret;
+}
+
+static int update_children(struct ngl_node **children, int nb_children, double t)
+{
+    for (int i = 0; i < nb_children; i++) {
+        int ret = ngli_node_update(children[i], t);
+        if (ret < 0)
+            return ret;
+    }
+    return 0;
+}
+
+int ngli_node_update_parallel(struct ngl_node *node, struct ngl_node **children, int nb_children, double t)
+{
+    struct ngl_ctx *ctx = node->ctx;
+
+    if (!ctx->update_pool || ctx->parallel_update || nb_children < 2 ||
+        !can_update_in_parallel(node, children, nb_children))
+        return update_children(children, nb_children, t);
+
+    struct parallel_update pu = {
+        .children = children,
+        .t        = t,
+    };
+
+    ctx->parallel_update = 1;
+    int ret = ngli_threadpool_run(ctx->update_pool, update_child_job, &pu, nb_children);
+    ctx->parallel_update = 0;
+
+    /* Honor the GL operations deferred by the nodes during the parallel update */
+    for (int i = 0; i < ctx->nb_deferred_updates; i++) {
+        const struct deferred_update *du = &ctx->deferred_updates[i];
+        du->func(du->node);
+    }
+    ctx->nb_deferred_updates = 0;
+
+    /* The nodes already updated for this time are skipped */
+    if (ctx->parallel_update_interrupted) {
+        LOG(DEBUG, "parallel update of %s interrupted, resuming it sequentially", node->name);
+        ctx->parallel_update_interrupted = 0;
+        return update_children(children, nb_children, t);
+    }
+
+    return ret;
+}
+
+int ngli_node_defer_update(struct ngl_node *node, void (*func)(struct ngl_node *node))
+{
+    struct ngl_ctx *ctx = node->ctx;
+    int ret = 0;
+
+    pthread_mutex_lock(&ctx->deferred_lock);
+    if (ctx->nb_deferred_updates == ctx->nb_deferred_updates_allocated) {
+        const int nb_allocated = ctx->nb_deferred_updates_allocated ? ctx->nb_deferred_updates_allocated * 2 : 16;
+        struct deferred_update *deferred_updates = realloc(ctx->deferred_updates,
+                                                           nb_allocated * sizeof(*deferred_updates));
+        if (!deferred_updates) {
+            ret = -1;
+            goto end;
+        }
+        ctx->deferred_updates = deferred_updates;
+        ctx->nb_deferred_updates_allocated = nb_allocated;
+    }
+    struct deferred_update *du = &ctx->deferred_updates[ctx->nb_deferred_updates++];
+    du->node = node;
+    du->func = func;
+end:
+    pthread_mutex_unlock(&ctx->deferred_lock);
+    return ret;
+}
+
 void ngli_node_draw(struct ngl_node *node)
 {
-    if (node->class->draw) {
+    const struct node_class *class = node->class;
+
+    if (class->draw) {
         LOG(VERBOSE, "DRAW %s @ %p", node->name, node);
-        node->class->draw(node);
+        struct tracer *tracer = node->ctx->tracer;
+        const int64_t trace_start = ngli_trace_start(tracer);
+        class->draw(node);
+        ngli_trace_end(tracer, "draw", node->name, class->name, trace_start);
+        return;
     }
+
+    if (class->pre_draw && !class->pre_draw(node))
+        return;
+
+    uint8_t *base_ptr = node->priv_data;
+    const struct node_param *par = class->params;
+
+    while (par && par->key) {
+        if (par->flags & PARAM_FLAG_DRAW_CHILD) {
+            if (par->type == PARAM_TYPE_NODE) {
+                struct ngl_node *child = *(struct ngl_node **)(base_ptr + par->offset);
+                if (child)
+                    ngli_node_draw(child);
+            } else if (par->type == PARAM_TYPE_NODELIST) {
+                uint8_t *elems_p = base_ptr + par->offset;
+                uint8_t *nb_elems_p = base_ptr + par->offset + sizeof(struct ngl_node **);
+                struct ngl_node **elems = *(struct ngl_node ***)elems_p;
+                const int nb_elems = *(int *)nb_elems_p;
+                for (int i = 0; i < nb_elems; i++)
+                    ngli_node_draw(elems[i]);
+            }
+        }
+        par++;
+    }
+
+    if (class->post_draw)
+        class->post_draw(node);
 }
 
 const struct node_param *ngli_node_param_find(const struct ngl_node *node, const char *key,
@@ -551,9 +909,18 @@ int ngl_node_param_add(struct ngl_node *node, const char *key,
     if (!par)
         return -1;
 
+    if (base_ptr == (uint8_t *)node && ngli_node_unshare_name(node) < 0)
+        return -1;
+
     ret = ngli_params_add(base_ptr, par, nb_elems, elems);
     if (ret < 0)
         LOG(ERROR, "unable to add elements to %s.%s", node->name, key);
+    if (node->ctx) {
+        if (par->flags & (PARAM_FLAG_DRAW_CHILD | PARAM_FLAG_DRAW_ORDER))
+            node->ctx->drawlist.dirty = 1;
+        node->ctx->params_generation++;
+    }
+    node->children_dirty = 1;
     node_uninit(node); // need a reinit after changing options
     return ret;
 }
@@ -568,18 +935,27 @@ int ngl_node_param_set(struct ngl_node *node, const char *key, ...)
     if (!par)
         return -1;
 
+    if (base_ptr == (uint8_t *)node && ngli_node_unshare_name(node) < 0)
+        return -1;
+
     va_start(ap, key);
     ret = ngli_params_set(base_ptr, par, &ap);
     if (ret < 0)
         LOG(ERROR, "unable to set %s.%s", node->name, key);
     va_end(ap);
+    if (node->ctx) {
+        if (par->flags & (PARAM_FLAG_DRAW_CHILD | PARAM_FLAG_DRAW_ORDER))
+            node->ctx->drawlist.dirty = 1;
+        node->ctx->params_generation++;
+    }
+    node->children_dirty = 1;
     node_uninit(node); // need a reinit after changing options
     return ret;
 }
 
 struct ngl_node *ngl_node_ref(struct ngl_node *node)
 {
-    node->refcount++;
+    __atomic_add_fetch(&node->refcount, 1, __ATOMIC_RELAXED);
     return node;
 }
 
@@ -590,13 +966,19 @@ void ngl_node_unrefp(struct ngl_node **nodep)
 
     if (!node)
         return;
-    delete = node->refcount-- == 1;
+    delete = __atomic_sub_fetch(&node->refcount, 1, __ATOMIC_ACQ_REL) == 0;
     if (delete) {
         LOG(VERBOSE, "DELETE %s @ %p", node->name, node);
         ngli_assert(!node->ctx);
+        if (has_default_name(node))
+            node->name = NULL;
         ngli_params_free((uint8_t *)node, ngli_base_node_params);
         ngli_params_free(node->priv_data, node->class->params);
-        free(node);
+        free(node->children);
+        if (node->arena_allocated)
+            ngli_arena_free(node);
+        else
+            free(node);
     }
     *nodep = NULL;
 }
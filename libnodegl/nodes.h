@@ -22,6 +22,7 @@
 #ifndef NODES_H
 #define NODES_H
 
+#include <pthread.h>
 #include <stdlib.h>
 #include <sxplayer.h>
 
@@ -34,11 +35,19 @@
 #include <CoreVideo/CoreVideo.h>
 #endif
 
+#include "arena.h"
+#include "drawlist.h"
 #include "glincludes.h"
 #include "glcontext.h"
 #include "glstate.h"
 #include "hmap.h"
+#include "log.h"
 #include "params.h"
+#include "prefetcher.h"
+#include "programcache.h"
+#include "threadpool.h"
+#include "trace.h"
+#include "uniformcache.h"
 
 struct node_class;
 
@@ -52,7 +61,34 @@ enum {
 struct ngl_ctx {
     struct glcontext *glcontext;
     struct glstate *glstate;
+    struct glbindings glbindings;
+    struct programcache *programcache;
+    struct hmap *shared_buffers;
     struct ngl_node *scene;
+    struct drawlist drawlist;
+    uint64_t params_generation;
+    struct log_ctx log_ctx;
+
+    /* Parallel update */
+    struct threadpool *update_pool;
+    int parallel_update;
+    int parallel_update_interrupted;
+    uint64_t walk_id;
+    pthread_mutex_t deferred_lock;
+    struct deferred_update *deferred_updates;
+    int nb_deferred_updates;
+    int nb_deferred_updates_allocated;
+
+    /* Asynchronous prefetch */
+    struct prefetcher *prefetcher;
+
+    /* Tracing, NULL when disabled */
+    struct tracer *tracer;
+};
+
+struct deferred_update {
+    struct ngl_node *node;
+    void (*func)(struct ngl_node *node);
 };
 
 struct ngl_node {
@@ -63,13 +99,32 @@ struct ngl_node {
     NGLI_ALIGNED_MAT(modelview_matrix);
     NGLI_ALIGNED_MAT(projection_matrix);
     int state;
+    int async_prefetch;
+    int async_prefetch_ret;
 
     double last_update_time;
+    uint64_t update_generation;
+    NGLI_ALIGNED_MAT(update_modelview_matrix);
+    NGLI_ALIGNED_MAT(update_projection_matrix);
+
+    int time_dependent;
+    uint64_t time_dependent_generation;
+
+    uint64_t walk_id;
+    int walk_owner;
+    uint64_t attach_id;
+    int parallel_update_capable;
+    uint64_t parallel_update_generation;
 
     int is_active;
     double visit_time;
 
     char *name;
+    int arena_allocated;
+
+    struct ngl_node **children;
+    int nb_children;
+    int children_dirty;
 
     void *priv_data;
 };
@@ -80,6 +135,12 @@ struct ngl_node {
                                            NGL_NODE_SCALE,     \
                                            -1}
 
+struct group {
+    struct ngl_node **children;
+    int nb_children;
+    int sort_draws;
+};
+
 struct graphicconfig {
     struct ngl_node *child;
 
@@ -130,6 +191,10 @@ struct camera {
 
     GLuint framebuffer_id;
     GLuint texture_id;
+
+    GLuint pbo_ids[2];
+    int pbo_index;
+    int pbo_pending;
 };
 
 struct geometry {
@@ -157,10 +222,30 @@ struct geometry {
     struct ngl_node *indices_buffer;
 
     GLenum draw_mode;
+    int static_attributes;
+
+    /* interleaved layout of the vertex attributes, if any */
+    struct ngl_node *interleaved_buffer;
+    int interleaved_stride;
+    int vertices_offset;
+    int uvcoords_offset;
+    int normals_offset;
+
+    /* axis-aligned bounding box of the vertices (min xyz, max xyz) */
+    float bounds[6];
+    int has_bounds;
 };
 
 struct ngl_node *ngli_geometry_generate_buffer(struct ngl_ctx *ctx, int type, int count, int size, void *data);
 struct ngl_node *ngli_geometry_generate_indices_buffer(struct ngl_ctx *ctx, int count);
+struct ngl_node *ngli_geometry_get_shared_buffer(struct ngl_ctx *ctx, int type, int count, int size, void *data);
+struct ngl_node *ngli_geometry_get_shared_attribute_buffer(struct ngl_ctx *ctx, int type, int count, int size, void *data);
+struct ngl_node *ngli_geometry_get_shared_indices_buffer(struct ngl_ctx *ctx, int count);
+void ngli_geometry_release_shared_buffer(struct ngl_node **nodep);
+void ngli_geometry_free_shared_buffer(void *user_arg, void *data);
+int ngli_geometry_compare(const struct ngl_node *g0, const struct ngl_node *g1);
+int ngli_geometry_init_interleaved_buffer(struct ngl_node *node);
+void ngli_geometry_compute_bounds(struct ngl_node *node);
 
 struct buffer {
     int count;              // number of elements
@@ -170,6 +255,7 @@ struct buffer {
     int data_comp;          // number of components per element
     int data_stride;        // stride of 1 element, in bytes
     GLenum data_comp_type;  // type of a single component: integer, float, ...
+    int normalized;         // normalize the integer components when used as a vertex attribute
     GLenum usage;
 
     /* animatedbuffer */
@@ -203,6 +289,8 @@ struct rtt {
     int height;
     GLuint framebuffer_id;
     GLuint renderbuffer_id;
+    GLuint prev_framebuffer_id;
+    GLint prev_viewport[4];
 };
 
 struct program {
@@ -216,14 +304,25 @@ struct program {
     GLint modelview_matrix_location_id;
     GLint projection_matrix_location_id;
     GLint normal_matrix_location_id;
+    GLint modelview_matrix_attrib_id;
+    GLint normal_matrix_attrib_id;
+
+    struct programcache_entry *cache_entry;
+    const struct programinfo *info;
+    struct uniformcache *uniformcache;
 };
 
 struct computeprogram {
     const char *compute;
 
     GLuint program_id;
+
+    struct programinfo info;
+    struct uniformcache uniformcache;
 };
 
+#define NGLI_TEXTURE_NB_UPLOAD_PBOS 3
+
 struct texture {
     GLenum target;
     GLint format;
@@ -250,6 +349,11 @@ struct texture {
     GLuint local_id;
     GLenum local_target;
 
+    int stream_uploads;
+    GLuint upload_pbos[NGLI_TEXTURE_NB_UPLOAD_PBOS];
+    int upload_pbo_index;
+    int upload_row_length;
+
     int upload_fmt;
     struct ngl_node *quad;
     struct ngl_node *program;
@@ -282,6 +386,13 @@ struct textureprograminfo {
     int ts_id;
 };
 
+struct uniformblockfield {
+    GLint offset;
+    GLint size;
+    GLint array_stride;
+    GLint matrix_stride;
+};
+
 struct render {
     struct ngl_node *geometry;
     struct ngl_node *program;
@@ -292,6 +403,7 @@ struct render {
 
     struct hmap *uniforms;
     GLint *uniform_ids;
+    GLint *uniform_attrib_ids;
 
     struct hmap *attributes;
     GLint *attribute_ids;
@@ -299,9 +411,31 @@ struct render {
     struct hmap *buffers;
     GLint *buffer_ids;
 
+    const char *uniform_block;
+    struct ngl_node *indirect_buffer;
+    int frustum_culling;
+
+    int nb_indirect_draws;
+
+    GLuint instance_buffer_id;
+    float *instance_data;
+    int instance_data_size;
+
+    struct uniformblockfield *uniform_block_fields;
+    struct uniformblockfield modelview_matrix_field;
+    struct uniformblockfield projection_matrix_field;
+    struct uniformblockfield normal_matrix_field;
+    GLuint ubo_id;
+    GLint ubo_binding;
+    uint8_t *ubo_data;
+    int ubo_size;
+    int ubo_dirty;
+
     GLuint vao_id;
 };
 
+void ngli_render_draw_instanced(struct ngl_node **nodes, int nb_nodes);
+
 struct compute {
     int nb_group_x;
     int nb_group_y;
@@ -415,6 +549,7 @@ struct fps {
     struct fps_measuring m_update;
     struct fps_measuring m_draw;
     struct fps_measuring m_total;
+    int64_t draw_start;
     int create_databuf;
     uint8_t *data_buf;
     int data_w, data_h;
@@ -453,17 +588,27 @@ struct fps {
  *  - release() has a weak dependency to prefetch(), so it will noop if not in
  *    the READY state.
  *
+ * If the context has a prefetcher, the prefetch() of the classes flagged with
+ * NODE_FLAG_ASYNC_PREFETCH is run in the background and the node only reaches
+ * the READY state once its result is collected by the rendering thread.
+ *
  * Note: nodes implementation do NOT have to implement this logic, but they can
  * rely on these properties in their callback implementations.
  */
+#define NODE_FLAG_TIME_DEPENDENT (1 << 0)
+#define NODE_FLAG_ASYNC_PREFETCH (1 << 1) /* prefetch() can run on the prefetcher context */
+
 struct node_class {
     int id;
     const char *name;
+    int flags;
     int (*init)(struct ngl_node *node);
     int (*visit)(struct ngl_node *node, int is_active, double t);
     int (*prefetch)(struct ngl_node *node);
     int (*update)(struct ngl_node *node, double t);
     void (*draw)(struct ngl_node *node);
+    int (*pre_draw)(struct ngl_node *node);
+    void (*post_draw)(struct ngl_node *node);
     void (*release)(struct ngl_node *node);
     void (*uninit)(struct ngl_node *node);
     char *(*info_str)(const struct ngl_node *node);
@@ -479,14 +624,16 @@ int ngli_node_init(struct ngl_node *node);
 int ngli_node_visit(struct ngl_node *node, int is_active, double t);
 int ngli_node_honor_release_prefetch(struct ngl_node *node, double t);
 int ngli_node_update(struct ngl_node *node, double t);
+int ngli_node_update_parallel(struct ngl_node *node, struct ngl_node **children, int nb_children, double t);
+int ngli_node_defer_update(struct ngl_node *node, void (*func)(struct ngl_node *node));
 void ngli_node_draw(struct ngl_node *node);
 
 int ngli_node_attach_ctx(struct ngl_node *node, struct ngl_ctx *ctx);
 void ngli_node_detach_ctx(struct ngl_node *node);
 
-char *ngli_node_default_name(const char *class_name);
 int ngli_is_default_name(const char *class_name, const char *str);
-struct ngl_node *ngli_node_create_noconstructor(int type);
+struct ngl_node *ngli_node_create_noconstructor(struct arena *arena, int type);
+int ngli_node_unshare_name(struct ngl_node *node);
 const struct node_param *ngli_node_param_find(const struct ngl_node *node, const char *key,
                                               uint8_t **base_ptrp);
 
@@ -62,6 +62,10 @@
     action(NGL_NODE_BUFFERUSVEC2,           ngli_bufferusvec2_class)            \
     action(NGL_NODE_BUFFERUSVEC3,           ngli_bufferusvec3_class)            \
     action(NGL_NODE_BUFFERUSVEC4,           ngli_bufferusvec4_class)            \
+    action(NGL_NODE_BUFFERHALFFLOAT,        ngli_bufferhalffloat_class)         \
+    action(NGL_NODE_BUFFERHVEC2,            ngli_bufferhvec2_class)             \
+    action(NGL_NODE_BUFFERHVEC3,            ngli_bufferhvec3_class)             \
+    action(NGL_NODE_BUFFERHVEC4,            ngli_bufferhvec4_class)             \
     action(NGL_NODE_BUFFERFLOAT,            ngli_bufferfloat_class)             \
     action(NGL_NODE_BUFFERVEC2,             ngli_buffervec2_class)              \
     action(NGL_NODE_BUFFERVEC3,             ngli_buffervec3_class)              \
@@ -66,6 +66,8 @@ struct param_choices {
 #define PARAM_FLAG_CONSTRUCTOR (1<<0)
 #define PARAM_FLAG_DOT_DISPLAY_PACKED (1<<1)
 #define PARAM_FLAG_DOT_DISPLAY_FIELDNAME (1<<2)
+#define PARAM_FLAG_DRAW_CHILD (1<<3)
+#define PARAM_FLAG_DRAW_ORDER (1<<4)
 struct node_param {
     const char *key;
     int type;
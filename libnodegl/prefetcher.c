@@ -0,0 +1,198 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "glcontext.h"
+#include "log.h"
+#include "nodes.h"
+#include "prefetcher.h"
+
+struct prefetcher {
+    struct glcontext *glcontext;
+    struct glfunctions gl;
+    struct ngl_frame_stats stats;
+    pthread_t thread;
+    int thread_started;
+
+    pthread_mutex_t lock;
+    pthread_cond_t queue_cond;
+    pthread_cond_t done_cond;
+    struct ngl_node **queue;
+    int queue_start;
+    int nb_queued;
+    int queue_size;
+    int quit;
+};
+
+static void *prefetcher_thread(void *arg)
+{
+    struct prefetcher *s = arg;
+
+    int ret = ngli_glcontext_make_current(s->glcontext, 1);
+    if (ret < 0)
+        LOG(ERROR, "unable to make the prefetch context current");
+
+    pthread_mutex_lock(&s->lock);
+    for (;;) {
+        while (!s->quit && !s->nb_queued)
+            pthread_cond_wait(&s->queue_cond, &s->lock);
+        if (s->quit)
+            break;
+
+        struct ngl_node *node = s->queue[s->queue_start];
+        s->queue_start = (s->queue_start + 1) % s->queue_size;
+        s->nb_queued--;
+        pthread_mutex_unlock(&s->lock);
+
+        int prefetch_ret = -1;
+        if (ret >= 0) {
+            ngli_log_set_thread_ctx(&node->ctx->log_ctx);
+            LOG(DEBUG, "ASYNC PREFETCH %s @ %p", node->name, node);
+            struct tracer *tracer = node->ctx->tracer;
+            const int64_t trace_start = ngli_trace_start(tracer);
+            prefetch_ret = node->class->prefetch(node);
+            ngli_glFinish(&s->gl);
+            ngli_trace_end(tracer, "prefetch", node->name, node->class->name, trace_start);
+            ngli_log_set_thread_ctx(NULL);
+        }
+
+        pthread_mutex_lock(&s->lock);
+        node->async_prefetch_ret = prefetch_ret;
+        node->async_prefetch = ASYNC_PREFETCH_DONE;
+        pthread_cond_broadcast(&s->done_cond);
+    }
+    pthread_mutex_unlock(&s->lock);
+
+    if (ret >= 0)
+        ngli_glcontext_make_current(s->glcontext, 0);
+
+    return NULL;
+}
+
+struct prefetcher *ngli_prefetcher_create(struct glcontext *glcontext)
+{
+    struct prefetcher *s = calloc(1, sizeof(*s));
+    if (!s)
+        return NULL;
+
+    /*
+     * The functions are shared with the rendering context, except for the
+     * frame statistics which are only accounted by the rendering thread.
+     */
+    s->gl = glcontext->funcs;
+    s->gl.stats = &s->stats;
+    s->glcontext = ngli_glcontext_new_shared(glcontext);
+    if (!s->glcontext) {
+        LOG(ERROR, "unable to create a shared context for the prefetch");
+        free(s);
+        return NULL;
+    }
+
+    pthread_mutex_init(&s->lock, NULL);
+    pthread_cond_init(&s->queue_cond, NULL);
+    pthread_cond_init(&s->done_cond, NULL);
+
+    if (pthread_create(&s->thread, NULL, prefetcher_thread, s)) {
+        ngli_prefetcher_freep(&s);
+        return NULL;
+    }
+    s->thread_started = 1;
+
+    return s;
+}
+
+const struct glfunctions *ngli_prefetcher_get_glfunctions(struct prefetcher *s)
+{
+    return &s->gl;
+}
+
+int ngli_prefetcher_submit(struct prefetcher *s, struct ngl_node *node)
+{
+    int ret = 0;
+
+    pthread_mutex_lock(&s->lock);
+    if (s->nb_queued == s->queue_size) {
+        const int queue_size = s->queue_size ? s->queue_size * 2 : 16;
+        struct ngl_node **queue = malloc(queue_size * sizeof(*queue));
+        if (!queue) {
+            ret = -1;
+            goto end;
+        }
+        for (int i = 0; i < s->nb_queued; i++)
+            queue[i] = s->queue[(s->queue_start + i) % s->queue_size];
+        free(s->queue);
+        s->queue = queue;
+        s->queue_start = 0;
+        s->queue_size = queue_size;
+    }
+    s->queue[(s->queue_start + s->nb_queued) % s->queue_size] = node;
+    s->nb_queued++;
+    node->async_prefetch = ASYNC_PREFETCH_PENDING;
+    pthread_cond_signal(&s->queue_cond);
+end:
+    pthread_mutex_unlock(&s->lock);
+    return ret;
+}
+
+int ngli_prefetcher_is_done(struct prefetcher *s, struct ngl_node *node)
+{
+    pthread_mutex_lock(&s->lock);
+    const int done = node->async_prefetch == ASYNC_PREFETCH_DONE;
+    pthread_mutex_unlock(&s->lock);
+    return done;
+}
+
+int ngli_prefetcher_wait(struct prefetcher *s, struct ngl_node *node)
+{
+    pthread_mutex_lock(&s->lock);
+    while (node->async_prefetch == ASYNC_PREFETCH_PENDING)
+        pthread_cond_wait(&s->done_cond, &s->lock);
+    const int ret = node->async_prefetch_ret;
+    node->async_prefetch = ASYNC_PREFETCH_NONE;
+    pthread_mutex_unlock(&s->lock);
+    return ret;
+}
+
+void ngli_prefetcher_freep(struct prefetcher **prefetcherp)
+{
+    struct prefetcher *s = *prefetcherp;
+
+    if (!s)
+        return;
+
+    if (s->thread_started) {
+        pthread_mutex_lock(&s->lock);
+        s->quit = 1;
+        pthread_cond_signal(&s->queue_cond);
+        pthread_mutex_unlock(&s->lock);
+        pthread_join(s->thread, NULL);
+    }
+
+    pthread_cond_destroy(&s->done_cond);
+    pthread_cond_destroy(&s->queue_cond);
+    pthread_mutex_destroy(&s->lock);
+    free(s->queue);
+    ngli_glcontext_freep(&s->glcontext);
+    free(s);
+    *prefetcherp = NULL;
+}
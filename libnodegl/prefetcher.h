@@ -0,0 +1,51 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef PREFETCHER_H
+#define PREFETCHER_H
+
+struct glcontext;
+struct glfunctions;
+struct ngl_node;
+
+enum {
+    ASYNC_PREFETCH_NONE,
+    ASYNC_PREFETCH_PENDING,
+    ASYNC_PREFETCH_DONE,
+};
+
+/*
+ * Background worker running the prefetch() callback of the nodes on its own
+ * OpenGL context, shared with the rendering one. Every prefetch is followed
+ * by a glFinish() so the resources are complete when the rendering thread
+ * gets notified. The nodes being prefetched must issue their GL calls through
+ * ngli_prefetcher_get_glfunctions().
+ */
+struct prefetcher;
+
+struct prefetcher *ngli_prefetcher_create(struct glcontext *glcontext);
+const struct glfunctions *ngli_prefetcher_get_glfunctions(struct prefetcher *prefetcher);
+int ngli_prefetcher_submit(struct prefetcher *prefetcher, struct ngl_node *node);
+int ngli_prefetcher_is_done(struct prefetcher *prefetcher, struct ngl_node *node);
+int ngli_prefetcher_wait(struct prefetcher *prefetcher, struct ngl_node *node);
+void ngli_prefetcher_freep(struct prefetcher **prefetcherp);
+
+#endif
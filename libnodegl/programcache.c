@@ -0,0 +1,404 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "glcontext.h"
+#include "glincludes.h"
+#include "glwrappers.h"
+#include "hmap.h"
+#include "log.h"
+#include "programcache.h"
+#include "utils.h"
+
+struct programcache {
+    struct hmap *entries;
+
+    /* On-disk binaries */
+    char *dir;
+    char *device;
+    GLint *binary_formats;
+    int nb_binary_formats;
+};
+
+static void free_entry(void *user_arg, void *data)
+{
+    struct programcache_entry *entry = data;
+    ngli_programinfo_reset(&entry->info);
+    ngli_uniformcache_reset(&entry->uniformcache);
+    free(entry->key);
+    free(entry->vertex);
+    free(entry->fragment);
+    free(entry);
+}
+
+struct programcache *ngli_programcache_create(void)
+{
+    struct programcache *s = calloc(1, sizeof(*s));
+    if (!s)
+        return NULL;
+    s->entries = ngli_hmap_create();
+    if (!s->entries) {
+        free(s);
+        return NULL;
+    }
+    ngli_hmap_set_free(s->entries, free_entry, NULL);
+    return s;
+}
+
+#define KEY_SIZE (2 * 8 + 1)
+
+static void get_key(char *key, const char *vertex, const char *fragment)
+{
+    snprintf(key, KEY_SIZE, "%08X%08X", ngli_crc32(vertex), ngli_crc32(fragment));
+}
+
+struct programcache_entry *ngli_programcache_get(struct programcache *s, const char *vertex, const char *fragment)
+{
+    char key[KEY_SIZE];
+    get_key(key, vertex, fragment);
+
+    struct programcache_entry *entry = ngli_hmap_get(s->entries, key);
+    if (!entry || strcmp(entry->vertex, vertex) || strcmp(entry->fragment, fragment))
+        return NULL;
+
+    entry->refcount++;
+    return entry;
+}
+
+struct programcache_entry *ngli_programcache_add(struct programcache *s, const char *vertex, const char *fragment, GLuint program_id)
+{
+    struct programcache_entry *entry = calloc(1, sizeof(*entry));
+    if (!entry)
+        return NULL;
+
+    entry->vertex   = ngli_strdup(vertex);
+    entry->fragment = ngli_strdup(fragment);
+    if (!entry->vertex || !entry->fragment) {
+        free_entry(NULL, entry);
+        return NULL;
+    }
+    entry->program_id = program_id;
+    entry->refcount   = 1;
+
+    /*
+     * In the unlikely event of a hash collision with different sources, the
+     * program is not shared and the entry is only owned by the caller.
+     */
+    char key[KEY_SIZE];
+    get_key(key, vertex, fragment);
+    if (ngli_hmap_get(s->entries, key))
+        return entry;
+
+    entry->key = ngli_strdup(key);
+    if (!entry->key || ngli_hmap_set(s->entries, key, entry) < 0) {
+        free(entry->key);
+        entry->key = NULL;
+    }
+    return entry;
+}
+
+void ngli_programcache_release(struct programcache *s, const struct glfunctions *gl, struct programcache_entry **entryp)
+{
+    struct programcache_entry *entry = *entryp;
+    if (!entry)
+        return;
+
+    *entryp = NULL;
+    if (--entry->refcount)
+        return;
+
+    ngli_glDeleteProgram(gl, entry->program_id);
+    if (entry->key)
+        ngli_hmap_set(s->entries, entry->key, NULL);
+    else
+        free_entry(NULL, entry);
+}
+
+void ngli_programcache_freep(struct programcache **sp)
+{
+    struct programcache *s = *sp;
+    if (!s)
+        return;
+    ngli_hmap_freep(&s->entries);
+    free(s->dir);
+    free(s->device);
+    free(s->binary_formats);
+    free(s);
+    *sp = NULL;
+}
+
+int ngli_programcache_set_dir(struct programcache *s, const char *dir)
+{
+    free(s->dir);
+    s->dir = NULL;
+    if (!dir)
+        return 0;
+    s->dir = ngli_strdup(dir);
+    return s->dir ? 0 : -1;
+}
+
+int ngli_programcache_has_binaries(const struct programcache *s, const struct glcontext *glcontext)
+{
+    return s->dir && (glcontext->features & NGLI_FEATURE_PROGRAM_BINARY);
+}
+
+/*
+ * A binary is only valid for the driver which produced it, so the driver
+ * identification strings are part of the key of the binaries
+ */
+static int probe_driver(struct programcache *s, const struct glcontext *glcontext)
+{
+    if (s->device)
+        return 0;
+
+    const struct glfunctions *gl = &glcontext->funcs;
+    const char *vendor   = (const char *)ngli_glGetString(gl, GL_VENDOR);
+    const char *renderer = (const char *)ngli_glGetString(gl, GL_RENDERER);
+    const char *version  = (const char *)ngli_glGetString(gl, GL_VERSION);
+    if (!vendor || !renderer || !version)
+        return -1;
+
+    GLint nb_binary_formats = 0;
+    ngli_glGetIntegerv(gl, GL_NUM_PROGRAM_BINARY_FORMATS, &nb_binary_formats);
+    if (nb_binary_formats <= 0)
+        return -1;
+
+    s->binary_formats = calloc(nb_binary_formats, sizeof(*s->binary_formats));
+    if (!s->binary_formats)
+        return -1;
+    ngli_glGetIntegerv(gl, GL_PROGRAM_BINARY_FORMATS, s->binary_formats);
+    s->nb_binary_formats = nb_binary_formats;
+
+    s->device = ngli_asprintf("%s\n%s\n%s", vendor, renderer, version);
+    if (!s->device)
+        return -1;
+
+    return 0;
+}
+
+static int is_binary_format_supported(const struct programcache *s, GLenum format)
+{
+    for (int i = 0; i < s->nb_binary_formats; i++)
+        if (s->binary_formats[i] == format)
+            return 1;
+    return 0;
+}
+
+static char *get_binary_path(const struct programcache *s, const char *vertex, const char *fragment)
+{
+    return ngli_asprintf("%s/%08X%08X%08X.bin", s->dir,
+                         ngli_crc32(vertex), ngli_crc32(fragment), ngli_crc32(s->device));
+}
+
+/*
+ * The identification strings and sources are stored along the binary (and
+ * compared at load) so a hash collision can not load a different program
+ */
+#define BINARY_MAGIC "NGLPBIN1"
+
+struct binary_header {
+    char magic[8];
+    uint32_t format;
+    uint32_t device_size;
+    uint32_t vertex_size;
+    uint32_t fragment_size;
+    uint32_t binary_size;
+};
+
+static const char *read_field(const char **p, const char *end, uint32_t size)
+{
+    const char *field = *p;
+    if (size > end - field)
+        return NULL;
+    *p += size;
+    return field;
+}
+
+static int check_field(const char *field, uint32_t size, const char *ref)
+{
+    return field && size == strlen(ref) && !memcmp(field, ref, size);
+}
+
+static char *read_file(const char *path, long *sizep)
+{
+    FILE *fp = fopen(path, "rb");
+    if (!fp)
+        return NULL;
+
+    char *buf = NULL;
+    if (fseek(fp, 0, SEEK_END) < 0)
+        goto end;
+    const long size = ftell(fp);
+    if (size < 0 || fseek(fp, 0, SEEK_SET) < 0)
+        goto end;
+
+    buf = malloc(size ? size : 1);
+    if (!buf)
+        goto end;
+    if (fread(buf, 1, size, fp) != size) {
+        free(buf);
+        buf = NULL;
+        goto end;
+    }
+    *sizep = size;
+
+end:
+    fclose(fp);
+    return buf;
+}
+
+GLuint ngli_programcache_load_binary(struct programcache *s, const struct glcontext *glcontext,
+                                     const char *vertex, const char *fragment)
+{
+    if (!ngli_programcache_has_binaries(s, glcontext) || probe_driver(s, glcontext) < 0)
+        return 0;
+
+    char *path = get_binary_path(s, vertex, fragment);
+    if (!path)
+        return 0;
+
+    GLuint program = 0;
+    long size = 0;
+    char *data = read_file(path, &size);
+    if (!data)
+        goto end;
+
+    struct binary_header header;
+    if (size < sizeof(header))
+        goto end;
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, BINARY_MAGIC, sizeof(header.magic)))
+        goto end;
+
+    const char *p = data + sizeof(header);
+    const char *end = data + size;
+    const char *device   = read_field(&p, end, header.device_size);
+    const char *vsource  = read_field(&p, end, header.vertex_size);
+    const char *fsource  = read_field(&p, end, header.fragment_size);
+    const char *binary   = read_field(&p, end, header.binary_size);
+    if (!check_field(device,  header.device_size,   s->device) ||
+        !check_field(vsource, header.vertex_size,   vertex) ||
+        !check_field(fsource, header.fragment_size, fragment) ||
+        !binary || !is_binary_format_supported(s, header.format))
+        goto end;
+
+    const struct glfunctions *gl = &glcontext->funcs;
+    program = ngli_glCreateProgram(gl);
+    ngli_glProgramBinary(gl, program, header.format, binary, header.binary_size);
+
+    GLint result = GL_FALSE;
+    ngli_glGetProgramiv(gl, program, GL_LINK_STATUS, &result);
+    if (!result) {
+        LOG(WARNING, "program binary %s rejected by the driver, recompiling", path);
+        ngli_glDeleteProgram(gl, program);
+        program = 0;
+        goto end;
+    }
+
+    LOG(VERBOSE, "loaded program binary %s", path);
+
+end:
+    free(data);
+    free(path);
+    return program;
+}
+
+static int write_file(const char *path, const struct binary_header *header,
+                      const char *device, const char *vertex, const char *fragment,
+                      const void *binary)
+{
+    FILE *fp = fopen(path, "wb");
+    if (!fp)
+        return -1;
+
+    const int ret = fwrite(header,   1, sizeof(*header),        fp) == sizeof(*header) &&
+                    fwrite(device,   1, header->device_size,   fp) == header->device_size &&
+                    fwrite(vertex,   1, header->vertex_size,   fp) == header->vertex_size &&
+                    fwrite(fragment, 1, header->fragment_size, fp) == header->fragment_size &&
+                    fwrite(binary,   1, header->binary_size,   fp) == header->binary_size;
+    return fclose(fp) == 0 && ret ? 0 : -1;
+}
+
+static char *get_tmp_path(const char *path)
+{
+    static unsigned tmp_id;
+    const unsigned id = __atomic_add_fetch(&tmp_id, 1, __ATOMIC_RELAXED);
+    return ngli_asprintf("%s.%ld.%u.tmp", path, (long)getpid(), id);
+}
+
+void ngli_programcache_save_binary(struct programcache *s, const struct glcontext *glcontext,
+                                   GLuint program_id, const char *vertex, const char *fragment)
+{
+    if (!ngli_programcache_has_binaries(s, glcontext) || probe_driver(s, glcontext) < 0)
+        return;
+
+    const struct glfunctions *gl = &glcontext->funcs;
+
+    GLint binary_size = 0;
+    ngli_glGetProgramiv(gl, program_id, GL_PROGRAM_BINARY_LENGTH, &binary_size);
+    if (binary_size <= 0)
+        return;
+
+    void *binary = malloc(binary_size);
+    char *path = get_binary_path(s, vertex, fragment);
+    char *tmp_path = path ? get_tmp_path(path) : NULL;
+    if (!binary || !tmp_path)
+        goto end;
+
+    GLenum format = 0;
+    GLsizei length = 0;
+    ngli_glGetProgramBinary(gl, program_id, binary_size, &length, &format, binary);
+    if (length <= 0)
+        goto end;
+
+    struct binary_header header = {
+        .format        = format,
+        .device_size   = strlen(s->device),
+        .vertex_size   = strlen(vertex),
+        .fragment_size = strlen(fragment),
+        .binary_size   = length,
+    };
+    memcpy(header.magic, BINARY_MAGIC, sizeof(header.magic));
+
+    /*
+     * Written under a temporary name unique to this writer so a concurrent
+     * run never loads a partial file, and concurrent writers never mix
+     * their data before the atomic rename
+     */
+    if (write_file(tmp_path, &header, s->device, vertex, fragment, binary) < 0 ||
+        rename(tmp_path, path) < 0) {
+        LOG(WARNING, "unable to store program binary %s", path);
+        remove(tmp_path);
+        goto end;
+    }
+
+    LOG(VERBOSE, "stored program binary %s", path);
+
+end:
+    free(tmp_path);
+    free(path);
+    free(binary);
+}
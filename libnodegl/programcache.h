@@ -0,0 +1,68 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef PROGRAMCACHE_H
+#define PROGRAMCACHE_H
+
+#include "glincludes.h"
+#include "programinfo.h"
+#include "uniformcache.h"
+
+struct glcontext;
+struct glfunctions;
+
+/*
+ * Per-context cache of the linked GL programs, keyed by the CRC32 of their
+ * vertex and fragment sources. Program nodes with byte-identical sources
+ * share the same GL program (and thus the same reflection table and uniform
+ * shadow cache, since uniform values are part of the program state); the
+ * program is deleted when its last user releases it.
+ *
+ * When a directory is set, the linked programs are also stored on disk using
+ * glGetProgramBinary() so the following runs (on the same driver) can skip
+ * the compilation and link.
+ */
+struct programcache_entry {
+    char *key;
+    char *vertex;
+    char *fragment;
+    GLuint program_id;
+    struct programinfo info;
+    struct uniformcache uniformcache;
+    int refcount;
+};
+
+struct programcache;
+
+struct programcache *ngli_programcache_create(void);
+struct programcache_entry *ngli_programcache_get(struct programcache *s, const char *vertex, const char *fragment);
+struct programcache_entry *ngli_programcache_add(struct programcache *s, const char *vertex, const char *fragment, GLuint program_id);
+void ngli_programcache_release(struct programcache *s, const struct glfunctions *gl, struct programcache_entry **entryp);
+
+int ngli_programcache_set_dir(struct programcache *s, const char *dir);
+int ngli_programcache_has_binaries(const struct programcache *s, const struct glcontext *glcontext);
+GLuint ngli_programcache_load_binary(struct programcache *s, const struct glcontext *glcontext,
+                                     const char *vertex, const char *fragment);
+void ngli_programcache_save_binary(struct programcache *s, const struct glcontext *glcontext,
+                                   GLuint program_id, const char *vertex, const char *fragment);
+void ngli_programcache_freep(struct programcache **sp);
+
+#endif
@@ -0,0 +1,214 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "glcontext.h"
+#include "glincludes.h"
+#include "glwrappers.h"
+#include "hmap.h"
+#include "log.h"
+#include "programinfo.h"
+
+static void free_info(void *user_arg, void *data)
+{
+    free(data);
+}
+
+static struct hmap *create_table(void)
+{
+    struct hmap *hm = ngli_hmap_create();
+    if (hm)
+        ngli_hmap_set_free(hm, free_info, NULL);
+    return hm;
+}
+
+/* Arrays are reported as "name[0]" but looked up by their base name */
+static void strip_array_suffix(char *name)
+{
+    const size_t len = strlen(name);
+    if (len > 3 && !strcmp(name + len - 3, "[0]"))
+        name[len - 3] = 0;
+}
+
+static int probe_uniforms(struct programinfo *s, const struct glfunctions *gl, GLuint program_id)
+{
+    GLint nb_uniforms = 0;
+    GLint max_name_len = 0;
+    ngli_glGetProgramiv(gl, program_id, GL_ACTIVE_UNIFORMS, &nb_uniforms);
+    ngli_glGetProgramiv(gl, program_id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_name_len);
+
+    char *name = malloc(max_name_len + 1);
+    if (!name)
+        return -1;
+
+    int ret = 0;
+    for (int i = 0; i < nb_uniforms; i++) {
+        struct uniformprograminfo *info = calloc(1, sizeof(*info));
+        if (!info) {
+            ret = -1;
+            break;
+        }
+
+        name[0] = 0;
+        ngli_glGetActiveUniform(gl, program_id, i, max_name_len + 1, NULL,
+                                &info->size, &info->type, name);
+        info->location = ngli_glGetUniformLocation(gl, program_id, name);
+        strip_array_suffix(name);
+
+        ret = ngli_hmap_set(s->uniforms, name, info);
+        if (ret < 0) {
+            free(info);
+            break;
+        }
+    }
+
+    free(name);
+    return ret < 0 ? ret : 0;
+}
+
+static int probe_attributes(struct programinfo *s, const struct glfunctions *gl, GLuint program_id)
+{
+    GLint nb_attributes = 0;
+    GLint max_name_len = 0;
+    ngli_glGetProgramiv(gl, program_id, GL_ACTIVE_ATTRIBUTES, &nb_attributes);
+    ngli_glGetProgramiv(gl, program_id, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &max_name_len);
+
+    char *name = malloc(max_name_len + 1);
+    if (!name)
+        return -1;
+
+    int ret = 0;
+    for (int i = 0; i < nb_attributes; i++) {
+        struct attributeprograminfo *info = calloc(1, sizeof(*info));
+        if (!info) {
+            ret = -1;
+            break;
+        }
+
+        name[0] = 0;
+        ngli_glGetActiveAttrib(gl, program_id, i, max_name_len + 1, NULL,
+                               &info->size, &info->type, name);
+        info->location = ngli_glGetAttribLocation(gl, program_id, name);
+        strip_array_suffix(name);
+
+        ret = ngli_hmap_set(s->attributes, name, info);
+        if (ret < 0) {
+            free(info);
+            break;
+        }
+    }
+
+    free(name);
+    return ret < 0 ? ret : 0;
+}
+
+static int probe_blocks(struct programinfo *s, const struct glfunctions *gl, GLuint program_id)
+{
+    GLint nb_blocks = 0;
+    GLint max_name_len = 0;
+    ngli_glGetProgramInterfaceiv(gl, program_id, GL_SHADER_STORAGE_BLOCK, GL_ACTIVE_RESOURCES, &nb_blocks);
+    ngli_glGetProgramInterfaceiv(gl, program_id, GL_SHADER_STORAGE_BLOCK, GL_MAX_NAME_LENGTH, &max_name_len);
+
+    char *name = malloc(max_name_len + 1);
+    if (!name)
+        return -1;
+
+    int ret = 0;
+    for (int i = 0; i < nb_blocks; i++) {
+        struct blockprograminfo *info = calloc(1, sizeof(*info));
+        if (!info) {
+            ret = -1;
+            break;
+        }
+
+        static const GLenum props[] = {GL_BUFFER_BINDING};
+        name[0] = 0;
+        ngli_glGetProgramResourceName(gl, program_id, GL_SHADER_STORAGE_BLOCK, i, max_name_len + 1, NULL, name);
+        ngli_glGetProgramResourceiv(gl, program_id, GL_SHADER_STORAGE_BLOCK, i,
+                                    1, props, 1, NULL, &info->binding);
+
+        ret = ngli_hmap_set(s->blocks, name, info);
+        if (ret < 0) {
+            free(info);
+            break;
+        }
+    }
+
+    free(name);
+    return ret < 0 ? ret : 0;
+}
+
+int ngli_programinfo_init(struct programinfo *s, const struct glcontext *glcontext, GLuint program_id)
+{
+    const struct glfunctions *gl = &glcontext->funcs;
+
+    s->uniforms   = create_table();
+    s->attributes = create_table();
+    s->blocks     = create_table();
+    if (!s->uniforms || !s->attributes || !s->blocks)
+        return -1;
+
+    int ret = probe_uniforms(s, gl, program_id);
+    if (ret < 0)
+        return ret;
+
+    ret = probe_attributes(s, gl, program_id);
+    if (ret < 0)
+        return ret;
+
+    if ((glcontext->features & NGLI_FEATURE_PROGRAM_INTERFACE_QUERY) &&
+        (glcontext->features & NGLI_FEATURE_SHADER_STORAGE_BUFFER_OBJECT)) {
+        ret = probe_blocks(s, gl, program_id);
+        if (ret < 0)
+            return ret;
+    }
+
+    LOG(VERBOSE, "program %u: %d uniforms, %d attributes, %d storage blocks", program_id,
+        ngli_hmap_count(s->uniforms), ngli_hmap_count(s->attributes), ngli_hmap_count(s->blocks));
+    return 0;
+}
+
+GLint ngli_programinfo_get_uniform_location(const struct programinfo *s, const char *name)
+{
+    const struct uniformprograminfo *info = ngli_hmap_get(s->uniforms, name);
+    return info ? info->location : -1;
+}
+
+GLint ngli_programinfo_get_attribute_location(const struct programinfo *s, const char *name)
+{
+    const struct attributeprograminfo *info = ngli_hmap_get(s->attributes, name);
+    return info ? info->location : -1;
+}
+
+GLint ngli_programinfo_get_block_binding(const struct programinfo *s, const char *name)
+{
+    const struct blockprograminfo *info = ngli_hmap_get(s->blocks, name);
+    return info ? info->binding : 0;
+}
+
+void ngli_programinfo_reset(struct programinfo *s)
+{
+    ngli_hmap_freep(&s->uniforms);
+    ngli_hmap_freep(&s->attributes);
+    ngli_hmap_freep(&s->blocks);
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef PROGRAMINFO_H
+#define PROGRAMINFO_H
+
+#include "glincludes.h"
+#include "hmap.h"
+
+struct glcontext;
+
+struct uniformprograminfo {
+    GLint location;
+    GLint size;
+    GLenum type;
+};
+
+struct attributeprograminfo {
+    GLint location;
+    GLint size;
+    GLenum type;
+};
+
+struct blockprograminfo {
+    GLint binding;
+};
+
+/*
+ * Reflection of the active uniforms, attributes and shader storage blocks of
+ * a linked program, enumerated once and indexed by name (the "[0]" suffix of
+ * arrays stripped) so the nodes using the program resolve their locations
+ * without any GL query.
+ */
+struct programinfo {
+    struct hmap *uniforms;
+    struct hmap *attributes;
+    struct hmap *blocks;
+};
+
+int ngli_programinfo_init(struct programinfo *s, const struct glcontext *glcontext, GLuint program_id);
+GLint ngli_programinfo_get_uniform_location(const struct programinfo *s, const char *name);
+GLint ngli_programinfo_get_attribute_location(const struct programinfo *s, const char *name);
+GLint ngli_programinfo_get_block_binding(const struct programinfo *s, const char *name);
+void ngli_programinfo_reset(struct programinfo *s);
+
+#endif
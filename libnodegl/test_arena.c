@@ -0,0 +1,77 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "arena.h"
+#include "utils.h"
+
+#define BLOCK_SIZE 256
+#define NB_ALLOCS 100
+
+static int is_zero(const uint8_t *p, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+        if (p[i])
+            return 0;
+    return 1;
+}
+
+int main(void)
+{
+    static const size_t sizes[] = {1, 3, 16, 17, 100, BLOCK_SIZE, 1000};
+
+    struct arena *arena = ngli_arena_create(BLOCK_SIZE);
+    ngli_assert(arena);
+
+    uint8_t *ptrs[NB_ALLOCS];
+    for (int i = 0; i < NB_ALLOCS; i++) {
+        const size_t size = sizes[i % NGLI_ARRAY_NB(sizes)];
+        ptrs[i] = ngli_arena_alloc(arena, size);
+        ngli_assert(ptrs[i]);
+        ngli_assert(((uintptr_t)ptrs[i] & (NGLI_ALIGN - 1)) == 0);
+        ngli_assert(is_zero(ptrs[i], size));
+        memset(ptrs[i], 0xff, size);
+    }
+
+    /* Consecutive small allocations are packed in the same block */
+    uint8_t *a = ngli_arena_alloc(arena, 8);
+    uint8_t *b = ngli_arena_alloc(arena, 8);
+    ngli_assert(a && b && b > a && b - a <= 2 * NGLI_ALIGN);
+
+    /* Free in an arbitrary order, the first half after the arena handle */
+    for (int i = NB_ALLOCS / 2; i < NB_ALLOCS; i += 2)
+        ngli_arena_free(ptrs[i]);
+    ngli_arena_free(a);
+    ngli_arena_freep(&arena);
+    ngli_assert(!arena);
+    ngli_arena_free(b);
+    for (int i = NB_ALLOCS / 2 + 1; i < NB_ALLOCS; i += 2)
+        ngli_arena_free(ptrs[i]);
+    for (int i = 0; i < NB_ALLOCS / 2; i++)
+        ngli_arena_free(ptrs[i]);
+
+    ngli_arena_free(NULL);
+    ngli_arena_freep(&arena);
+
+    return 0;
+}
@@ -25,6 +25,8 @@
 #include "utils.h"
 #include "math_utils.h"
 
+#define NB_BENCH_ITER 1000000
+
 static void flt_diff(float *dst, const float *a, const float *b, int size)
 {
     for (int i = 0; i < size; i++)
@@ -42,34 +44,138 @@ static void flt_check(const float *f, int size)
     printf("=> OK\n");
 }
 
-int main(void)
+static void print_speed(const char *name, int64_t ref_time, int64_t time)
 {
-    static const NGLI_ALIGNED_MAT(m1) = {
-        0.73016,  0.51184, 0.20930, -7.42311,
-       -9.42693,  1.47287, 0.34995,  0.42049,
-        0.42603, -1.50442, 1.34210,  3.04868,
-        0.53013,  0.68963, 0.25207,  1.96254,
-    };
+    printf("%s: %gns/call (C: %gns/call, x%.2f)\n", name,
+           time * 1000. / NB_BENCH_ITER, ref_time * 1000. / NB_BENCH_ITER,
+           time ? (double)ref_time / time : 0.);
+}
 
-    static const NGLI_ALIGNED_MAT(m2) = {
-        0.08222, 0.62387, 0.79754,  0.64541,
-        1.70126, 2.24977, 0.05395, -3.00599,
-        0.30858, 0.90973, 0.84432, -4.01016,
-        6.19681, 5.45165, 0.77647,  0.59262,
-    };
+static const NGLI_ALIGNED_MAT(m1) = {
+    0.73016,  0.51184, 0.20930, -7.42311,
+   -9.42693,  1.47287, 0.34995,  0.42049,
+    0.42603, -1.50442, 1.34210,  3.04868,
+    0.53013,  0.68963, 0.25207,  1.96254,
+};
 
-    printf("m1:\n" NGLI_FMT_MAT4 "\n", NGLI_ARG_MAT4(m1));
-    printf("m2:\n" NGLI_FMT_MAT4 "\n", NGLI_ARG_MAT4(m2));
+static const NGLI_ALIGNED_MAT(m2) = {
+    0.08222, 0.62387, 0.79754,  0.64541,
+    1.70126, 2.24977, 0.05395, -3.00599,
+    0.30858, 0.90973, 0.84432, -4.01016,
+    6.19681, 5.45165, 0.77647,  0.59262,
+};
 
-    if (ngli_mat4_mul_c != ngli_mat4_mul) {
-        printf(":: Testing mat4 mul\n");
+typedef void (*mat4_mul_func)(float *dst, const float *m1, const float *m2);
+typedef void (*mat4_mul_vec4_func)(float *dst, const float *m, const float *v);
+typedef void (*mat3_inverse_func)(float *dst, const float *m);
+typedef void (*rotation_from_quat_func)(float *dst, const float *quat);
+typedef void (*quat_slerp_func)(float *dst, const float *q1, const float *q2, float t);
+
+static void test_mat4_mul(const char *name, mat4_mul_func func)
+{
+    printf(":: Testing mat4 mul (%s)\n", name);
+
+    NGLI_ALIGNED_MAT(m_ref);
+    NGLI_ALIGNED_MAT(m_out) = {0};
+    NGLI_ALIGNED_MAT(m_diff);
+
+    ngli_mat4_mul_c(m_ref, m1, m2);
+    func(m_out, m1, m2);
+    flt_diff(m_diff, m_ref, m_out, 4*4);
+
+    printf("ref:\n"  NGLI_FMT_MAT4 "\n", NGLI_ARG_MAT4(m_ref));
+    printf("out:\n"  NGLI_FMT_MAT4 "\n", NGLI_ARG_MAT4(m_out));
+    printf("diff:\n" NGLI_FMT_MAT4 "\n", NGLI_ARG_MAT4(m_diff));
+    flt_check(m_diff, 4*4);
+
+    int64_t start = ngli_gettime();
+    for (int i = 0; i < NB_BENCH_ITER; i++)
+        ngli_mat4_mul_c(m_ref, m1, m2);
+    const int64_t ref_time = ngli_gettime() - start;
+    start = ngli_gettime();
+    for (int i = 0; i < NB_BENCH_ITER; i++)
+        func(m_out, m1, m2);
+    print_speed(name, ref_time, ngli_gettime() - start);
+}
+
+static void test_mat4_mul_vec4(const char *name, mat4_mul_vec4_func func)
+{
+    for (int i = 0; i < 4; i++) {
+        printf(":: Testing mat4 mul vec4 %d/4 (%s)\n", i + 1, name);
+
+        const float *v = &m2[i * 4];
+
+        NGLI_ALIGNED_VEC(v_ref);
+        NGLI_ALIGNED_VEC(v_out) = {0};
+        NGLI_ALIGNED_VEC(v_diff);
+
+        ngli_mat4_mul_vec4_c(v_ref, m1, v);
+        func(v_out, m1, v);
+        flt_diff(v_diff, v_ref, v_out, 4);
+
+        printf("ref:  " NGLI_FMT_VEC4 "\n", NGLI_ARG_VEC4(v_ref));
+        printf("out:  " NGLI_FMT_VEC4 "\n", NGLI_ARG_VEC4(v_out));
+        printf("diff: " NGLI_FMT_VEC4 "\n", NGLI_ARG_VEC4(v_diff));
+        flt_check(v_diff, 4);
+    }
+
+    NGLI_ALIGNED_VEC(v);
+    int64_t start = ngli_gettime();
+    for (int i = 0; i < NB_BENCH_ITER; i++)
+        ngli_mat4_mul_vec4_c(v, m1, &m2[(i & 3) * 4]);
+    const int64_t ref_time = ngli_gettime() - start;
+    start = ngli_gettime();
+    for (int i = 0; i < NB_BENCH_ITER; i++)
+        func(v, m1, &m2[(i & 3) * 4]);
+    print_speed(name, ref_time, ngli_gettime() - start);
+}
+
+static void test_mat3_inverse(const char *name, mat3_inverse_func func)
+{
+    printf(":: Testing mat3 inverse (%s)\n", name);
+
+    float m[3*3];
+    float m_ref[3*3];
+    float m_out[3*3] = {0};
+    float m_diff[3*3];
+
+    ngli_mat3_from_mat4(m, m1);
+    ngli_mat3_inverse_c(m_ref, m);
+    func(m_out, m);
+    flt_diff(m_diff, m_ref, m_out, 3*3);
+
+    printf("ref:\n"  NGLI_FMT_MAT3 "\n", NGLI_ARG_MAT3(m_ref));
+    printf("out:\n"  NGLI_FMT_MAT3 "\n", NGLI_ARG_MAT3(m_out));
+    printf("diff:\n" NGLI_FMT_MAT3 "\n", NGLI_ARG_MAT3(m_diff));
+    flt_check(m_diff, 3*3);
+
+    int64_t start = ngli_gettime();
+    for (int i = 0; i < NB_BENCH_ITER; i++)
+        ngli_mat3_inverse_c(m_ref, m);
+    const int64_t ref_time = ngli_gettime() - start;
+    start = ngli_gettime();
+    for (int i = 0; i < NB_BENCH_ITER; i++)
+        func(m_out, m);
+    print_speed(name, ref_time, ngli_gettime() - start);
+}
+
+static void test_rotation_from_quat(const char *name, rotation_from_quat_func func)
+{
+    static const float quats[][4] = {
+        {0.0, 0.0, 0.0, 1.0},
+        {0.18257, 0.36515, 0.54772, 0.73030},
+        {-1.2, 0.4, 2.1, -0.7}, /* not normalized */
+    };
+
+    for (int i = 0; i < NGLI_ARRAY_NB(quats); i++) {
+        printf(":: Testing mat4 rotation from quat %d/%d (%s)\n", i + 1, NGLI_ARRAY_NB(quats), name);
 
         NGLI_ALIGNED_MAT(m_ref);
         NGLI_ALIGNED_MAT(m_out) = {0};
         NGLI_ALIGNED_MAT(m_diff);
 
-        ngli_mat4_mul_c(m_ref, m1, m2);
-        ngli_mat4_mul(m_out, m1, m2);
+        ngli_mat4_rotation_from_quat_c(m_ref, quats[i]);
+        func(m_out, quats[i]);
         flt_diff(m_diff, m_ref, m_out, 4*4);
 
         printf("ref:\n"  NGLI_FMT_MAT4 "\n", NGLI_ARG_MAT4(m_ref));
@@ -78,18 +184,37 @@ int main(void)
         flt_check(m_diff, 4*4);
     }
 
-    if (ngli_mat4_mul_vec4_c != ngli_mat4_mul_vec4) {
-        for (int i = 0; i < 4; i++) {
-            printf(":: Testing mat4 mul vec4 %d/4\n", i + 1);
+    NGLI_ALIGNED_MAT(m);
+    int64_t start = ngli_gettime();
+    for (int i = 0; i < NB_BENCH_ITER; i++)
+        ngli_mat4_rotation_from_quat_c(m, quats[i & 1]);
+    const int64_t ref_time = ngli_gettime() - start;
+    start = ngli_gettime();
+    for (int i = 0; i < NB_BENCH_ITER; i++)
+        func(m, quats[i & 1]);
+    print_speed(name, ref_time, ngli_gettime() - start);
+}
+
+static void test_quat_slerp(const char *name, quat_slerp_func func)
+{
+    static const float quats[][2][4] = {
+        {{0.0, 0.0, 0.0, 1.0}, {0.18257, 0.36515, 0.54772, 0.73030}},
+        {{0.18257, 0.36515, 0.54772, 0.73030}, {-0.5, 0.5, -0.5, -0.5}}, /* negative dot */
+        {{0.0, 0.0, 0.0, 1.0}, {0.0, 0.0, 0.01, 0.99995}},               /* close quaternions */
+    };
+    static const float ts[] = {0.0, 0.3, 0.5, 1.0};
 
-            const float *v = &m2[i * 4];
+    for (int i = 0; i < NGLI_ARRAY_NB(quats); i++) {
+        for (int j = 0; j < NGLI_ARRAY_NB(ts); j++) {
+            printf(":: Testing quat slerp %d/%d with t=%g (%s)\n",
+                   i + 1, NGLI_ARRAY_NB(quats), ts[j], name);
 
             NGLI_ALIGNED_VEC(v_ref);
             NGLI_ALIGNED_VEC(v_out) = {0};
             NGLI_ALIGNED_VEC(v_diff);
 
-            ngli_mat4_mul_vec4_c(v_ref, m1, v);
-            ngli_mat4_mul_vec4(v_out, m1, v);
+            ngli_quat_slerp_c(v_ref, quats[i][0], quats[i][1], ts[j]);
+            func(v_out, quats[i][0], quats[i][1], ts[j]);
             flt_diff(v_diff, v_ref, v_out, 4);
 
             printf("ref:  " NGLI_FMT_VEC4 "\n", NGLI_ARG_VEC4(v_ref));
@@ -99,5 +224,46 @@ int main(void)
         }
     }
 
+    NGLI_ALIGNED_VEC(v);
+    int64_t start = ngli_gettime();
+    for (int i = 0; i < NB_BENCH_ITER; i++)
+        ngli_quat_slerp_c(v, quats[0][0], quats[0][1], (i & 0xff) / 255.f);
+    const int64_t ref_time = ngli_gettime() - start;
+    start = ngli_gettime();
+    for (int i = 0; i < NB_BENCH_ITER; i++)
+        func(v, quats[0][0], quats[0][1], (i & 0xff) / 255.f);
+    print_speed(name, ref_time, ngli_gettime() - start);
+}
+
+int main(void)
+{
+    printf("m1:\n" NGLI_FMT_MAT4 "\n", NGLI_ARG_MAT4(m1));
+    printf("m2:\n" NGLI_FMT_MAT4 "\n", NGLI_ARG_MAT4(m2));
+
+#if defined(ARCH_AARCH64)
+    test_mat4_mul("aarch64", ngli_mat4_mul_aarch64);
+    test_mat4_mul_vec4("aarch64", ngli_mat4_mul_vec4_aarch64);
+#elif defined(ARCH_X86_64)
+    test_mat4_mul("sse", ngli_mat4_mul_sse);
+    if (ngli_x86_64_has_avx())
+        test_mat4_mul("avx", ngli_mat4_mul_avx);
+    test_mat4_mul_vec4("sse", ngli_mat4_mul_vec4_sse);
+    test_mat3_inverse("sse", ngli_mat3_inverse_sse);
+    test_rotation_from_quat("sse", ngli_mat4_rotation_from_quat_sse);
+    test_quat_slerp("sse", ngli_quat_slerp_sse);
+#endif
+
+    /* Kernels selected for the running CPU */
+    if (ngli_mat4_mul_c != ngli_mat4_mul)
+        test_mat4_mul("dispatched", ngli_mat4_mul);
+    if (ngli_mat4_mul_vec4_c != ngli_mat4_mul_vec4)
+        test_mat4_mul_vec4("dispatched", ngli_mat4_mul_vec4);
+    if (ngli_mat3_inverse_c != ngli_mat3_inverse)
+        test_mat3_inverse("dispatched", ngli_mat3_inverse);
+    if (ngli_mat4_rotation_from_quat_c != ngli_mat4_rotation_from_quat)
+        test_rotation_from_quat("dispatched", ngli_mat4_rotation_from_quat);
+    if (ngli_quat_slerp_c != ngli_quat_slerp)
+        test_quat_slerp("dispatched", ngli_quat_slerp);
+
     return 0;
 }
@@ -86,6 +86,26 @@ int main(void)
             PRINT_HMAP("drop %s (%d remaining):\n", kvs[i].key, ngli_hmap_count(hm));
         }
 
+        /* Test re-addition after the buckets got emptied */
+        for (int i = 0; i < NGLI_ARRAY_NB(kvs) - 1; i++) {
+            void *data = custom_alloc ? ngli_strdup(kvs[i].val) : (void*)kvs[i].val;
+            ngli_assert(ngli_hmap_set(hm, kvs[i].key, data) >= 0);
+            ngli_assert(!strcmp(ngli_hmap_get(hm, kvs[i].key), kvs[i].val));
+        }
+        ngli_assert(ngli_hmap_count(hm) == NGLI_ARRAY_NB(kvs));
+        PRINT_HMAP("re-add [%d entries]:\n", ngli_hmap_count(hm));
+
+        /* Test delete of every entry and re-addition of a few */
+        for (int i = 0; i < NGLI_ARRAY_NB(kvs); i++)
+            ngli_assert(ngli_hmap_set(hm, kvs[i].key, NULL) == 1);
+        ngli_assert(ngli_hmap_count(hm) == 0);
+        for (int i = 0; i < 2; i++) {
+            void *data = custom_alloc ? ngli_strdup(kvs[i].val) : (void*)kvs[i].val;
+            ngli_assert(ngli_hmap_set(hm, kvs[i].key, data) >= 0);
+        }
+        ngli_assert(ngli_hmap_count(hm) == 2);
+        PRINT_HMAP("drop all and re-add [%d entries]:\n", ngli_hmap_count(hm));
+
         ngli_hmap_freep(&hm);
     }
 
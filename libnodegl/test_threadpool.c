@@ -0,0 +1,112 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <time.h>
+
+#include "threadpool.h"
+#include "utils.h"
+
+#define NB_WORKERS 3
+#define NB_JOBS 64
+#define INTERRUPT_JOB 10
+
+struct job_ctx {
+    int runs[NB_JOBS];
+    int done[NB_JOBS];
+    int interrupted;
+    int interrupt;
+};
+
+static void sleep_us(long us)
+{
+    const struct timespec ts = {.tv_sec = 0, .tv_nsec = us * 1000};
+    nanosleep(&ts, NULL);
+}
+
+static int job_func(void *arg, int job_id)
+{
+    struct job_ctx *s = arg;
+
+    __atomic_add_fetch(&s->runs[job_id], 1, __ATOMIC_RELAXED);
+
+    /* Jobs already completed by a previous interrupted run are skipped */
+    if (s->done[job_id])
+        return 0;
+
+    /* Once interrupted, the remaining jobs bail out */
+    if (__atomic_load_n(&s->interrupted, __ATOMIC_RELAXED))
+        return -1;
+
+    if (s->interrupt && job_id == INTERRUPT_JOB) {
+        __atomic_store_n(&s->interrupted, 1, __ATOMIC_RELAXED);
+        return -1;
+    }
+
+    sleep_us(job_id % 4 * 100);
+    s->done[job_id] = 1;
+    return 0;
+}
+
+static void check_runs(const struct job_ctx *s, int nb_jobs, int nb_runs)
+{
+    for (int i = 0; i < nb_jobs; i++)
+        ngli_assert(s->runs[i] == nb_runs);
+    for (int i = nb_jobs; i < NB_JOBS; i++)
+        ngli_assert(s->runs[i] == 0);
+}
+
+int main(void)
+{
+    struct threadpool *pool = ngli_threadpool_create(NB_WORKERS);
+    ngli_assert(pool);
+
+    /* Wait: every job is executed exactly once before the run returns */
+    static const int nb_jobs_list[] = {0, 1, NB_WORKERS, NB_WORKERS + 1, NB_JOBS};
+    for (int i = 0; i < NGLI_ARRAY_NB(nb_jobs_list); i++) {
+        const int nb_jobs = nb_jobs_list[i];
+        struct job_ctx s = {0};
+        ngli_assert(ngli_threadpool_run(pool, job_func, &s, nb_jobs) == 0);
+        check_runs(&s, nb_jobs, 1);
+        for (int j = 0; j < nb_jobs; j++)
+            ngli_assert(s.done[j]);
+    }
+
+    /* Interrupt: the error is reported once all the jobs are over */
+    struct job_ctx s = {.interrupt = 1};
+    ngli_assert(ngli_threadpool_run(pool, job_func, &s, NB_JOBS) < 0);
+    ngli_assert(s.interrupted);
+    ngli_assert(!s.done[INTERRUPT_JOB]);
+    check_runs(&s, NB_JOBS, 1);
+
+    /* Resume: a new run completes the jobs left over by the interrupted one */
+    s.interrupt = 0;
+    s.interrupted = 0;
+    ngli_assert(ngli_threadpool_run(pool, job_func, &s, NB_JOBS) == 0);
+    check_runs(&s, NB_JOBS, 2);
+    for (int i = 0; i < NB_JOBS; i++)
+        ngli_assert(s.done[i]);
+
+    ngli_threadpool_freep(&pool);
+    ngli_assert(!pool);
+    ngli_threadpool_freep(&pool);
+
+    return 0;
+}
@@ -25,5 +25,7 @@ int main(void)
 {
     ngli_assert(ngli_crc32("") == 0);
     ngli_assert(ngli_crc32("Hello world !@#$%^&*()_+") == 0xDCEB8676);
+    ngli_assert(ngli_crc32_data(NULL, 0) == 0);
+    ngli_assert(ngli_crc32_data((const uint8_t *)"Hello world !@#$%^&*()_+", 24) == 0xDCEB8676);
     return 0;
 }
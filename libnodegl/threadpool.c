@@ -0,0 +1,161 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "log.h"
+#include "threadpool.h"
+
+struct threadpool {
+    pthread_t *workers;
+    int nb_workers;
+
+    pthread_mutex_t lock;
+    pthread_cond_t work_cond;
+    pthread_cond_t done_cond;
+    int quit;
+
+    /* Current batch of jobs, protected by lock */
+    threadpool_func func;
+    void *arg;
+    int nb_jobs;
+    int next_job;
+    int nb_done;
+    int ret;
+};
+
+/*
+ * Jobs are not assigned to a specific worker: every thread (the caller
+ * included) picks the next pending job as soon as it is idle, so a worker
+ * stuck on a heavy job does not delay the others. Must be called with the
+ * lock held.
+ */
+static void run_jobs(struct threadpool *pool)
+{
+    while (pool->next_job < pool->nb_jobs) {
+        const int job_id = pool->next_job++;
+        threadpool_func func = pool->func;
+        void *arg = pool->arg;
+
+        pthread_mutex_unlock(&pool->lock);
+        const int ret = func(arg, job_id);
+        pthread_mutex_lock(&pool->lock);
+
+        if (ret < 0 && pool->ret >= 0)
+            pool->ret = ret;
+        if (++pool->nb_done == pool->nb_jobs)
+            pthread_cond_signal(&pool->done_cond);
+    }
+}
+
+static void *worker_thread(void *arg)
+{
+    struct threadpool *pool = arg;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->quit && pool->next_job >= pool->nb_jobs)
+            pthread_cond_wait(&pool->work_cond, &pool->lock);
+        if (pool->quit)
+            break;
+        run_jobs(pool);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+struct threadpool *ngli_threadpool_create(int nb_workers)
+{
+    struct threadpool *pool = calloc(1, sizeof(*pool));
+    if (!pool)
+        return NULL;
+
+    pool->workers = calloc(nb_workers, sizeof(*pool->workers));
+    if (!pool->workers) {
+        free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_cond, NULL);
+    pthread_cond_init(&pool->done_cond, NULL);
+
+    for (int i = 0; i < nb_workers; i++) {
+        if (pthread_create(&pool->workers[i], NULL, worker_thread, pool)) {
+            LOG(ERROR, "unable to create worker thread %d", i);
+            ngli_threadpool_freep(&pool);
+            return NULL;
+        }
+        pool->nb_workers++;
+    }
+
+    return pool;
+}
+
+int ngli_threadpool_run(struct threadpool *pool, threadpool_func func, void *arg, int nb_jobs)
+{
+    pthread_mutex_lock(&pool->lock);
+
+    pool->func     = func;
+    pool->arg      = arg;
+    pool->nb_jobs  = nb_jobs;
+    pool->next_job = 0;
+    pool->nb_done  = 0;
+    pool->ret      = 0;
+    pthread_cond_broadcast(&pool->work_cond);
+
+    run_jobs(pool);
+    while (pool->nb_done < pool->nb_jobs)
+        pthread_cond_wait(&pool->done_cond, &pool->lock);
+
+    const int ret = pool->ret;
+    pool->nb_jobs  = 0;
+    pool->next_job = 0;
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return ret;
+}
+
+void ngli_threadpool_freep(struct threadpool **poolp)
+{
+    struct threadpool *pool = *poolp;
+
+    if (!pool)
+        return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = 1;
+    pthread_cond_broadcast(&pool->work_cond);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->nb_workers; i++)
+        pthread_join(pool->workers[i], NULL);
+
+    pthread_cond_destroy(&pool->done_cond);
+    pthread_cond_destroy(&pool->work_cond);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->workers);
+    free(pool);
+    *poolp = NULL;
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+struct threadpool;
+
+typedef int (*threadpool_func)(void *arg, int job_id);
+
+struct threadpool *ngli_threadpool_create(int nb_workers);
+
+/*
+ * Execute the jobs [0, nb_jobs) in parallel, using the pool workers as well
+ * as the calling thread. The call is blocking until all the jobs are done.
+ *
+ * Returns 0 on success or the first error raised by a job.
+ */
+int ngli_threadpool_run(struct threadpool *pool, threadpool_func func, void *arg, int nb_jobs);
+
+void ngli_threadpool_freep(struct threadpool **poolp);
+
+#endif
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bstr.h"
+#include "log.h"
+#include "trace.h"
+#include "utils.h"
+
+struct trace_event {
+    uint64_t seq; /* index of the event + 1 once fully written, 0 while being written */
+    const char *op;
+    const char *category;
+    char name[64];
+    int64_t ts;
+    int64_t dur;
+    uint64_t tid;
+};
+
+struct tracer {
+    struct trace_event *events;
+    uint64_t mask;
+    uint64_t head;
+    int64_t origin;
+};
+
+struct tracer *ngli_tracer_create(int nb_events)
+{
+    if (nb_events <= 0)
+        return NULL;
+
+    struct tracer *s = calloc(1, sizeof(*s));
+    if (!s)
+        return NULL;
+
+    uint64_t size = 1;
+    while (size < nb_events)
+        size <<= 1;
+
+    s->events = calloc(size, sizeof(*s->events));
+    if (!s->events) {
+        free(s);
+        return NULL;
+    }
+    s->mask = size - 1;
+    s->origin = ngli_gettime();
+    return s;
+}
+
+void ngli_tracer_add(struct tracer *s, const char *op, const char *name,
+                     const char *category, int64_t start_time)
+{
+    const int64_t end_time = ngli_gettime();
+    const uint64_t index = __atomic_fetch_add(&s->head, 1, __ATOMIC_RELAXED);
+    struct trace_event *ev = &s->events[index & s->mask];
+
+    __atomic_store_n(&ev->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    ev->op       = op;
+    ev->category = category;
+    ev->ts       = start_time - s->origin;
+    ev->dur      = end_time - start_time;
+    ev->tid      = (uint64_t)(uintptr_t)pthread_self();
+    snprintf(ev->name, sizeof(ev->name), "%s", name ? name : "");
+
+    __atomic_store_n(&ev->seq, index + 1, __ATOMIC_RELEASE);
+}
+
+static void print_json_str(struct bstr *b, const char *s)
+{
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\')
+            ngli_bstr_print(b, "\\%c", *s);
+        else if ((unsigned char)*s < 0x20)
+            ngli_bstr_print(b, "\\u%04x", *s);
+        else
+            ngli_bstr_print(b, "%c", *s);
+    }
+}
+
+char *ngli_tracer_dump(struct tracer *s)
+{
+    struct bstr *b = ngli_bstr_create();
+    if (!b)
+        return NULL;
+
+    const uint64_t head = __atomic_load_n(&s->head, __ATOMIC_ACQUIRE);
+    const uint64_t size = s->mask + 1;
+    const uint64_t first = head > size ? head - size : 0;
+    int nb_printed = 0;
+
+    ngli_bstr_print(b, "{\"traceEvents\":[");
+    for (uint64_t i = first; i < head; i++) {
+        const struct trace_event *ev = &s->events[i & s->mask];
+        if (__atomic_load_n(&ev->seq, __ATOMIC_ACQUIRE) != i + 1)
+            continue;
+
+        struct trace_event copy = *ev;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&ev->seq, __ATOMIC_RELAXED) != i + 1)
+            continue; // overwritten while being read
+
+        ngli_bstr_print(b, "%s\n{\"name\":\"%s", nb_printed ? "," : "", copy.op);
+        if (*copy.name) {
+            ngli_bstr_print(b, " ");
+            print_json_str(b, copy.name);
+        }
+        ngli_bstr_print(b, "\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%" PRId64 ",\"dur\":%" PRId64
+                        ",\"pid\":0,\"tid\":%" PRIu64 "}",
+                        copy.category, copy.ts, copy.dur, copy.tid);
+        nb_printed++;
+    }
+    ngli_bstr_print(b, "\n]}\n");
+
+    if (head - first > nb_printed)
+        LOG(DEBUG, "%d trace events skipped while being written", (int)(head - first - nb_printed));
+
+    char *ret = ngli_bstr_strdup(b);
+    ngli_bstr_freep(&b);
+    return ret;
+}
+
+void ngli_tracer_freep(struct tracer **tracerp)
+{
+    struct tracer *s = *tracerp;
+
+    if (!s)
+        return;
+
+    free(s->events);
+    free(s);
+    *tracerp = NULL;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+
+#include "utils.h"
+
+/*
+ * Ring buffer of timed events, dumpable in the Chrome trace_event JSON
+ * format. Events can be recorded from any thread without locking; the oldest
+ * ones are overwritten once the buffer is full.
+ */
+struct tracer;
+
+struct tracer *ngli_tracer_create(int nb_events);
+void ngli_tracer_add(struct tracer *tracer, const char *op, const char *name,
+                     const char *category, int64_t start_time);
+char *ngli_tracer_dump(struct tracer *tracer);
+void ngli_tracer_freep(struct tracer **tracerp);
+
+/*
+ * Hooks meant for the hot paths: they do nothing but a pointer check when the
+ * tracing is disabled.
+ */
+static inline int64_t ngli_trace_start(const struct tracer *tracer)
+{
+    return tracer ? ngli_gettime() : 0;
+}
+
+static inline void ngli_trace_end(struct tracer *tracer, const char *op, const char *name,
+                                  const char *category, int64_t start_time)
+{
+    if (tracer)
+        ngli_tracer_add(tracer, op, name, category, start_time);
+}
+
+#endif
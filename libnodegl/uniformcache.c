@@ -0,0 +1,131 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "glincludes.h"
+#include "glwrappers.h"
+#include "uniformcache.h"
+
+/*
+ * Locations are small dense integers with every known driver; anything
+ * above this limit is simply uploaded without being cached.
+ */
+#define MAX_CACHED_LOCATION 1024
+
+struct uniformcache_entry {
+    int size;
+    void *data;
+};
+
+/*
+ * Returns 1 if the value needs to be uploaded, 0 if the program already
+ * holds it. Allocation failures disable caching for the location but still
+ * require the upload.
+ */
+static int check_and_store(struct uniformcache *c, GLint location, const void *data, int size)
+{
+    if (location < 0)
+        return 0;
+
+    if (location >= MAX_CACHED_LOCATION)
+        return 1;
+
+    if (location >= c->nb_entries) {
+        const int nb_entries = location + 1;
+        struct uniformcache_entry *entries = realloc(c->entries, nb_entries * sizeof(*entries));
+        if (!entries)
+            return 1;
+        memset(entries + c->nb_entries, 0, (nb_entries - c->nb_entries) * sizeof(*entries));
+        c->entries = entries;
+        c->nb_entries = nb_entries;
+    }
+
+    struct uniformcache_entry *entry = &c->entries[location];
+    if (entry->size == size && !memcmp(entry->data, data, size))
+        return 0;
+
+    if (entry->size != size) {
+        void *buf = realloc(entry->data, size);
+        if (!buf) {
+            free(entry->data);
+            entry->data = NULL;
+            entry->size = 0;
+            return 1;
+        }
+        entry->data = buf;
+        entry->size = size;
+    }
+    memcpy(entry->data, data, size);
+    return 1;
+}
+
+void ngli_uniformcache_1f(const struct glfunctions *gl, struct uniformcache *c,
+                          GLint location, GLfloat v)
+{
+    if (check_and_store(c, location, &v, sizeof(v)))
+        ngli_glUniform1f(gl, location, v);
+}
+
+void ngli_uniformcache_1i(const struct glfunctions *gl, struct uniformcache *c,
+                          GLint location, GLint v)
+{
+    if (check_and_store(c, location, &v, sizeof(v)))
+        ngli_glUniform1i(gl, location, v);
+}
+
+void ngli_uniformcache_fv(const struct glfunctions *gl, struct uniformcache *c,
+                          GLint location, int nb_comp, GLsizei count, const GLfloat *v)
+{
+    if (!check_and_store(c, location, v, nb_comp * count * sizeof(*v)))
+        return;
+
+    switch (nb_comp) {
+    case 1: ngli_glUniform1fv(gl, location, count, v); break;
+    case 2: ngli_glUniform2fv(gl, location, count, v); break;
+    case 3: ngli_glUniform3fv(gl, location, count, v); break;
+    case 4: ngli_glUniform4fv(gl, location, count, v); break;
+    }
+}
+
+void ngli_uniformcache_matrix3fv(const struct glfunctions *gl, struct uniformcache *c,
+                                 GLint location, const GLfloat *v)
+{
+    if (check_and_store(c, location, v, 3 * 3 * sizeof(*v)))
+        ngli_glUniformMatrix3fv(gl, location, 1, GL_FALSE, v);
+}
+
+void ngli_uniformcache_matrix4fv(const struct glfunctions *gl, struct uniformcache *c,
+                                 GLint location, const GLfloat *v)
+{
+    if (check_and_store(c, location, v, 4 * 4 * sizeof(*v)))
+        ngli_glUniformMatrix4fv(gl, location, 1, GL_FALSE, v);
+}
+
+void ngli_uniformcache_reset(struct uniformcache *c)
+{
+    for (int i = 0; i < c->nb_entries; i++)
+        free(c->entries[i].data);
+    free(c->entries);
+    c->entries = NULL;
+    c->nb_entries = 0;
+}
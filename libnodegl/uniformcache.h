@@ -0,0 +1,55 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef UNIFORMCACHE_H
+#define UNIFORMCACHE_H
+
+#include "glincludes.h"
+
+struct glfunctions;
+
+/*
+ * Shadow copy of the uniform values last uploaded to a program, indexed by
+ * uniform location. Uniform values are part of the program object state, so
+ * the cache must live alongside the program and be reset whenever the
+ * program is (re)linked or destroyed. The setters only reach GL when the
+ * value differs from the one already held by the program.
+ */
+struct uniformcache_entry;
+
+struct uniformcache {
+    struct uniformcache_entry *entries;
+    int nb_entries;
+};
+
+void ngli_uniformcache_1f(const struct glfunctions *gl, struct uniformcache *c,
+                          GLint location, GLfloat v);
+void ngli_uniformcache_1i(const struct glfunctions *gl, struct uniformcache *c,
+                          GLint location, GLint v);
+void ngli_uniformcache_fv(const struct glfunctions *gl, struct uniformcache *c,
+                          GLint location, int nb_comp, GLsizei count, const GLfloat *v);
+void ngli_uniformcache_matrix3fv(const struct glfunctions *gl, struct uniformcache *c,
+                                 GLint location, const GLfloat *v);
+void ngli_uniformcache_matrix4fv(const struct glfunctions *gl, struct uniformcache *c,
+                                 GLint location, const GLfloat *v);
+void ngli_uniformcache_reset(struct uniformcache *c);
+
+#endif
@@ -91,3 +91,16 @@ uint32_t ngli_crc32(const char *s)
     }
     return ~crc;
 }
+
+uint32_t ngli_crc32_data(const uint8_t *data, int size)
+{
+    uint32_t crc = ~0;
+    for (int i = 0; i < size; i++) {
+        crc ^= data[i];
+        for (int j = 0; j < 8; j++) {
+            const uint32_t mask = -(crc & 1);
+            crc = (crc >> 1) ^ (mask & 0xEDB88320);
+        }
+    }
+    return ~crc;
+}
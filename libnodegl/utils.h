@@ -94,5 +94,6 @@ char *ngli_strdup(const char *s);
 int64_t ngli_gettime(void);
 char *ngli_asprintf(const char *fmt, ...) ngli_printf_format(1, 2);
 uint32_t ngli_crc32(const char *s);
+uint32_t ngli_crc32_data(const uint8_t *data, int size);
 
 #endif /* UTILS_H */
@@ -20,7 +20,14 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <sys/stat.h>
 #include <sys/time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <nodegl.h>
 
 #include <GLFW/glfw3.h>
 
@@ -41,6 +48,35 @@ double clipd(double v, double min, double max)
     return v;
 }
 
+struct ngl_node *get_scene(const char *filename)
+{
+    struct ngl_node *scene = NULL;
+    char *buf = NULL;
+    struct stat st;
+
+    int fd = open(filename, O_RDONLY);
+    if (fd == -1)
+        goto end;
+
+    if (fstat(fd, &st) == -1)
+        goto end;
+
+    buf = malloc(st.st_size + 1);
+    if (!buf)
+        goto end;
+
+    int n = read(fd, buf, st.st_size);
+    buf[n] = 0;
+
+    scene = ngl_node_deserialize(buf);
+
+end:
+    if (fd != -1)
+        close(fd);
+    free(buf);
+    return scene;
+}
+
 int init_glfw(void)
 {
     if (!glfwInit()) {
@@ -30,6 +30,9 @@
 int64_t gettime(void);
 double clipd(double v, double min, double max);
 
+struct ngl_node;
+struct ngl_node *get_scene(const char *filename);
+
 int init_glfw(void);
 GLFWwindow *get_window(const char *title, int width, int height);
 
@@ -33,35 +33,6 @@
 
 #include "common.h"
 
-static struct ngl_node *get_scene(const char *filename)
-{
-    struct ngl_node *scene = NULL;
-    char *buf = NULL;
-    struct stat st;
-
-    int fd = open(filename, O_RDONLY);
-    if (fd == -1)
-        goto end;
-
-    if (fstat(fd, &st) == -1)
-        goto end;
-
-    buf = malloc(st.st_size + 1);
-    if (!buf)
-        goto end;
-
-    int n = read(fd, buf, st.st_size);
-    buf[n] = 0;
-
-    scene = ngl_node_deserialize(buf);
-
-end:
-    if (fd != -1)
-        close(fd);
-    free(buf);
-    return scene;
-}
-
 struct range {
     float start;
     float duration;
@@ -0,0 +1,279 @@
+/*
+ * Copyright 2017 GoPro Inc.
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <nodegl.h>
+
+#include <GLFW/glfw3.h>
+
+#include "common.h"
+
+struct worker {
+    int id;
+    GLFWwindow *window;
+    pthread_t thread;
+    const char * const *inputs;
+    int nb_inputs;
+    int nb_frames;
+    int width, height;
+    int nb_rendered;
+    int ret;
+};
+
+static void log_callback(void *arg, int level, const char *filename, int ln,
+                         const char *fn, const char *fmt, va_list vl)
+{
+    const struct worker *w = arg;
+    char logline[512];
+
+    if (level < NGL_LOG_WARNING)
+        return;
+
+    vsnprintf(logline, sizeof(logline), fmt, vl);
+    fprintf(stderr, "[thread %d] %s:%d %s: %s\n", w->id, filename, ln, fn, logline);
+}
+
+static void quiet_log_callback(void *arg, int level, const char *filename, int ln,
+                               const char *fn, const char *fmt, va_list vl)
+{
+}
+
+/*
+ * Associating a scene already owned by another context must fail, and must
+ * not leave the nodes attached before the failure bound to the new context.
+ */
+static int check_scene_ownership(struct worker *w, struct ngl_node *scene)
+{
+    int ret = -1;
+    struct ngl_ctx *ctx = ngl_create();
+    struct ngl_node *leaf = ngl_node_create(NGL_NODE_GROUP);
+    struct ngl_node *group = ngl_node_create(NGL_NODE_GROUP);
+    struct ngl_node *children[] = {leaf, scene};
+
+    if (!ctx || !leaf || !group)
+        goto end;
+
+    ngl_set_log_callback(ctx, NULL, quiet_log_callback);
+
+    if (ngl_node_param_add(group, "children", 2, children) < 0)
+        goto end;
+
+    if (ngl_set_scene(ctx, group) >= 0) {
+        fprintf(stderr, "[thread %d] Scene associated with two contexts\n", w->id);
+        goto end;
+    }
+
+    ret = 0;
+
+end:
+    ngl_free(&ctx);
+    ngl_node_unrefp(&group);
+    ngl_node_unrefp(&leaf);
+    return ret;
+}
+
+static int render_scene(struct worker *w, const char *input)
+{
+    int ret = 0;
+    struct ngl_ctx *ctx = NULL;
+
+    struct ngl_node *scene = get_scene(input);
+    if (!scene) {
+        fprintf(stderr, "[thread %d] Unable to load %s\n", w->id, input);
+        return -1;
+    }
+
+    ctx = ngl_create();
+    if (!ctx) {
+        ret = -1;
+        goto end;
+    }
+
+    ngl_set_log_callback(ctx, w, log_callback);
+
+    ret = ngl_set_glcontext(ctx, NULL, NULL, NULL, NGL_GLPLATFORM_AUTO, NGL_GLAPI_AUTO);
+    if (ret < 0)
+        goto end;
+    glViewport(0, 0, w->width, w->height);
+
+    ret = ngl_set_scene(ctx, scene);
+    if (ret < 0)
+        goto end;
+
+    ret = check_scene_ownership(w, scene);
+    if (ret < 0)
+        goto end;
+
+    for (int k = 0; k < w->nb_frames; k++) {
+        const double t = k / 60.;
+        ret = ngl_draw(ctx, t);
+        if (ret < 0) {
+            fprintf(stderr, "[thread %d] Unable to draw %s @ t=%g\n", w->id, input, t);
+            goto end;
+        }
+        glfwSwapBuffers(w->window);
+        w->nb_rendered++;
+    }
+
+end:
+    ngl_free(&ctx);
+    ngl_node_unrefp(&scene);
+    return ret;
+}
+
+static void *worker_thread(void *arg)
+{
+    struct worker *w = arg;
+
+    glfwMakeContextCurrent(w->window);
+
+    /* Every worker goes through all the scenes, each from a different offset */
+    for (int i = 0; i < w->nb_inputs; i++) {
+        const char *input = w->inputs[(w->id + i) % w->nb_inputs];
+        w->ret = render_scene(w, input);
+        if (w->ret < 0)
+            break;
+    }
+
+    glfwMakeContextCurrent(NULL);
+    return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+    int ret = EXIT_SUCCESS;
+    int nb_threads = 4;
+    int nb_frames = 60;
+    int width = 320, height = 240;
+    int nb_inputs = 0;
+    const char **inputs = calloc(argc, sizeof(*inputs));
+
+    if (!inputs)
+        return EXIT_FAILURE;
+
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] == '-' && i < argc - 1) {
+            const char opt = argv[i][1];
+            const char *arg = argv[i + 1];
+            switch (opt) {
+                case 'j':
+                    nb_threads = atoi(arg);
+                    break;
+                case 'n':
+                    nb_frames = atoi(arg);
+                    break;
+                case 's':
+                    if (sscanf(arg, "%dx%d", &width, &height) != 2) {
+                        fprintf(stderr, "Invalid size format: \"%s\" "
+                                "is not following \"WxH\"\n", arg);
+                        free(inputs);
+                        return EXIT_FAILURE;
+                    }
+                    break;
+                default:
+                    fprintf(stderr, "Unknown option -%c\n", opt);
+                    free(inputs);
+                    return EXIT_FAILURE;
+            }
+            i++;
+        } else {
+            inputs[nb_inputs++] = argv[i];
+        }
+    }
+
+    if (!nb_inputs || nb_threads < 1) {
+        fprintf(stderr, "Usage: %s [-j nb_threads] [-n nb_frames] [-s WxH] input.ngl [input.ngl ...]\n", argv[0]);
+        free(inputs);
+        return EXIT_FAILURE;
+    }
+
+    if (init_glfw() < 0) {
+        free(inputs);
+        return EXIT_FAILURE;
+    }
+
+    struct worker *workers = calloc(nb_threads, sizeof(*workers));
+    if (!workers) {
+        ret = EXIT_FAILURE;
+        goto end;
+    }
+
+    /* The windows must be created from the main thread */
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    for (int i = 0; i < nb_threads; i++) {
+        struct worker *w = &workers[i];
+        w->window = get_window("ngl-stress", width, height);
+        if (!w->window) {
+            ret = EXIT_FAILURE;
+            goto end;
+        }
+        glfwMakeContextCurrent(NULL);
+    }
+
+    printf("Rendering %d scene(s) on %d threads\n", nb_inputs, nb_threads);
+
+    const int64_t start = gettime();
+
+    int nb_started = 0;
+    for (int i = 0; i < nb_threads; i++) {
+        struct worker *w = &workers[i];
+        w->id        = i;
+        w->inputs    = inputs;
+        w->nb_inputs = nb_inputs;
+        w->nb_frames = nb_frames;
+        w->width     = width;
+        w->height    = height;
+        if (pthread_create(&w->thread, NULL, worker_thread, w)) {
+            ret = EXIT_FAILURE;
+            break;
+        }
+        nb_started++;
+    }
+
+    int nb_rendered = 0;
+    for (int i = 0; i < nb_started; i++) {
+        struct worker *w = &workers[i];
+        pthread_join(w->thread, NULL);
+        if (w->ret < 0)
+            ret = EXIT_FAILURE;
+        nb_rendered += w->nb_rendered;
+    }
+
+    const double tdiff = (gettime() - start) / 1000000.;
+    printf("Rendered %d frames in %g (FPS=%g)\n", nb_rendered, tdiff, nb_rendered / tdiff);
+
+end:
+    if (workers) {
+        for (int i = 0; i < nb_threads; i++)
+            if (workers[i].window)
+                glfwDestroyWindow(workers[i].window);
+        free(workers);
+    }
+    free(inputs);
+    glfwTerminate();
+
+    return ret;
+}
@@ -15,9 +15,11 @@ from pynodegl import (
         AnimatedQuat,
         BufferUBVec3,
         BufferUBVec4,
+        BufferUInt,
         BufferUIVec4,
         BufferVec2,
         BufferVec3,
+        BufferVec4,
         Camera,
         Circle,
         Compute,
@@ -551,3 +553,118 @@ def quaternion(cfg):
     camera.set_perspective(45.0, cfg.aspect_ratio_float, 1.0, 10.0)
 
     return camera
+
+
+@scene(nb_colors={'type': 'range', 'range': [2, 64]})
+def uniform_block(cfg, nb_colors=32):
+    shader_version = '300 es' if cfg.glbackend == 'gles' else '330'
+    shader_header = '#version %s\n' % shader_version
+
+    palette_data = array.array('f')
+    for i in range(nb_colors):
+        a = 2 * math.pi * i / float(nb_colors)
+        palette_data.extend([
+            .5 + .5 * math.cos(a),
+            .5 + .5 * math.cos(a + 2 * math.pi / 3.),
+            .5 + .5 * math.cos(a + 4 * math.pi / 3.),
+            1,
+        ])
+    palette = BufferVec4(data=palette_data)
+
+    shift_animkf = [AnimKeyFrameFloat(0, 0),
+                    AnimKeyFrameFloat(cfg.duration, 1)]
+    shift = UniformFloat(anim=AnimatedFloat(shift_animkf))
+
+    q = Quad((-1, -1, 0), (2, 0, 0), (0, 2, 0))
+    p = Program(vertex=shader_header + get_vert('uniform-block'),
+                fragment=shader_header + get_frag('uniform-block'))
+    render = Render(q, p, uniform_block='ngl_uniforms')
+    render.update_uniforms(palette=palette)
+    render.update_uniforms(nb_colors=UniformInt(nb_colors))
+    render.update_uniforms(shift=shift)
+    return render
+
+
+@scene(nb_particules={'type': 'range', 'range': [1, 1000]})
+def instancing(cfg, nb_particules=500):
+    random.seed(0)
+    shader_version = '300 es' if cfg.glbackend == 'gles' else '330'
+    shader_header = '#version %s\n' % shader_version
+
+    circle = Circle(radius=0.02)
+    p = Program(vertex=shader_header + get_vert('instancing'),
+                fragment=shader_header + get_frag('instancing'))
+
+    g = Group(sort_draws=True)
+    for i in range(nb_particules):
+        render = Render(circle, p)
+        render.update_uniforms(color=UniformVec4(value=(random.random(), random.random(), random.random(), 1)))
+        src = (random.uniform(-1, 1), random.uniform(-1, 1), 0)
+        dst = (random.uniform(-1, 1), random.uniform(-1, 1), 0)
+        animkf = [AnimKeyFrameVec3(0, src),
+                  AnimKeyFrameVec3(cfg.duration / 2., dst, 'quadratic_in_out'),
+                  AnimKeyFrameVec3(cfg.duration, src, 'quadratic_in_out')]
+        g.add_children(Translate(render, anim=AnimatedVec3(animkf)))
+    return g
+
+
+@scene()
+def vertex_colors(cfg):
+    colors_data = array.array('B', [255,   0,   0, 255,
+                                      0, 255,   0, 255,
+                                      0,   0, 255, 255,
+                                    255, 255,   0, 255])
+    colors = BufferUBVec4(data=colors_data, normalized=True)
+
+    q = Quad((-1, -1, 0), (2, 0, 0), (0, 2, 0))
+    p = Program(vertex=get_vert('vertex-color'), fragment=get_frag('vertex-color'))
+    render = Render(q, p)
+    render.update_attributes(color=colors)
+    return render
+
+
+@scene(npoints={'type': 'range', 'range': [3, 128]})
+def indirect_pie(cfg, npoints=64):
+    compute_data_version = "310 es" if cfg.glbackend == "gles" else "430"
+    compute_data = '#version %s\n' % compute_data_version
+    compute_data += get_comp('indirect-pie')
+
+    commands = BufferUInt(5)
+
+    animkf = [AnimKeyFrameFloat(0, 0),
+              AnimKeyFrameFloat(cfg.duration, 1)]
+    c = Compute(1, 1, 1, ComputeProgram(compute_data))
+    c.update_uniforms(progress=UniformFloat(anim=AnimatedFloat(animkf)),
+                      npoints=UniformInt(npoints))
+    c.update_buffers(commands_buffer=commands)
+
+    circle = Circle(radius=0.8, npoints=npoints)
+    p = Program(fragment=get_frag('color'))
+    r = Render(circle, p, indirect_buffer=commands)
+    r.update_uniforms(color=UniformVec4(value=(0, .6, .8, 1)))
+
+    return Group(children=(c, r))
+
+
+@scene(dim={'type': 'range', 'range': [1, 100]})
+def frustum_culling(cfg, dim=50):
+    q = Quad((-.4, -.4, 0), (.8, 0, 0), (0, .8, 0))
+    p = Program(fragment=get_frag('triangle'))
+
+    g = Group()
+    for y in range(dim):
+        for x in range(dim):
+            render = Render(q, p, frustum_culling=True)
+            g.add_children(Translate(render, vector=(x - dim / 2., y - dim / 2., 0)))
+
+    # travel across the grid, most of the quads being out of sight
+    animkf = [AnimKeyFrameVec3(0, (dim / 2., dim / 2., 0)),
+              AnimKeyFrameVec3(cfg.duration, (-dim / 2., -dim / 2., 0))]
+    world = Translate(g, anim=AnimatedVec3(animkf))
+
+    camera = Camera(world)
+    camera.set_eye(0.0, 0.0, 5.0)
+    camera.set_center(0.0, 0.0, 0.0)
+    camera.set_up(0.0, 1.0, 0.0)
+    camera.set_perspective(45.0, cfg.aspect_ratio_float, 1.0, 10.0)
+    return camera
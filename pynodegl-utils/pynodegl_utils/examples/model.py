@@ -93,7 +93,7 @@ def obj(cfg, n=0.5, model=None):
     texcoords = BufferVec2(data=uvs_data)
     normals = BufferVec3(data=normals_data)
 
-    q = Geometry(vertices, texcoords, normals)
+    q = Geometry(vertices, texcoords, normals, static_attributes=True)
     m = Media(cfg.medias[0].filename)
     t = Texture2D(data_src=m)
     p = Program(fragment=get_frag('tex-tint-normals'))
@@ -144,7 +144,7 @@ def stl(cfg, stl=None, scale=.8):
     vertices = BufferVec3(data=vertices_data)
     normals  = BufferVec3(data=normals_data)
 
-    g = Geometry(vertices=vertices, normals=normals)
+    g = Geometry(vertices=vertices, normals=normals, static_attributes=True)
     p = Program(fragment=get_frag('colored-normals'))
     solid = Render(g, p, name=solid_name)
     solid = GraphicConfig(solid, depth_test=True)
@@ -0,0 +1,9 @@
+precision mediump float;
+
+in vec4 var_color;
+out vec4 frag_color;
+
+void main()
+{
+    frag_color = var_color;
+}
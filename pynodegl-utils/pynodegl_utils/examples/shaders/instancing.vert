@@ -0,0 +1,13 @@
+in vec4 ngl_position;
+in mat4 ngl_modelview_matrix;
+in vec4 color;
+
+uniform mat4 ngl_projection_matrix;
+
+out vec4 var_color;
+
+void main()
+{
+    gl_Position = ngl_projection_matrix * ngl_modelview_matrix * ngl_position;
+    var_color = color;
+}
@@ -0,0 +1,19 @@
+precision highp float;
+
+layout(std140) uniform ngl_uniforms {
+    mat4 ngl_modelview_matrix;
+    mat4 ngl_projection_matrix;
+    vec4 palette[64];
+    int nb_colors;
+    float shift;
+};
+
+in vec2 var_uvcoord;
+out vec4 frag_color;
+
+void main()
+{
+    float n = float(nb_colors);
+    int i = int(mod(var_uvcoord.x * n + shift * n, n));
+    frag_color = palette[i];
+}
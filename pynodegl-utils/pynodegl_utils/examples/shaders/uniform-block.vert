@@ -0,0 +1,18 @@
+in vec4 ngl_position;
+in vec2 ngl_uvcoord;
+
+layout(std140) uniform ngl_uniforms {
+    mat4 ngl_modelview_matrix;
+    mat4 ngl_projection_matrix;
+    vec4 palette[64];
+    int nb_colors;
+    float shift;
+};
+
+out vec2 var_uvcoord;
+
+void main()
+{
+    gl_Position = ngl_projection_matrix * ngl_modelview_matrix * ngl_position;
+    var_uvcoord = ngl_uvcoord;
+}
@@ -0,0 +1,7 @@
+#version 100
+precision mediump float;
+varying vec4 var_color;
+void main(void)
+{
+    gl_FragColor = var_color;
+}
@@ -0,0 +1,12 @@
+#version 100
+precision highp float;
+attribute vec4 ngl_position;
+attribute vec4 color;
+uniform mat4 ngl_modelview_matrix;
+uniform mat4 ngl_projection_matrix;
+varying vec4 var_color;
+void main()
+{
+    gl_Position = ngl_projection_matrix * ngl_modelview_matrix * ngl_position;
+    var_color = color;
+}
@@ -87,6 +87,10 @@ class Exporter(QtCore.QObject):
             glctx.swapBuffers(surface)
         self.progressed.emit(100)
 
+        # The last frame may still be in flight: destroying the node.gl
+        # context flushes it into the pipe
+        del ngl_viewer
+
         os.close(fd_w)
         fbo.release()
         glctx.doneCurrent()
@@ -1,4 +1,5 @@
 from libc.stdlib cimport calloc
+from libc.stdint cimport int64_t
 
 cdef extern from "nodegl.h":
     cdef int NGL_LOG_VERBOSE
@@ -38,6 +39,26 @@ cdef extern from "nodegl.h":
 
     ngl_ctx *ngl_create()
     int ngl_set_glcontext(ngl_ctx *s, void *display, void *window, void *handle, int platform, int api)
+    int ngl_set_update_threads(ngl_ctx *s, int nb_threads)
+    int ngl_set_async_prefetch(ngl_ctx *s, int enable)
+    int ngl_set_program_cache_dir(ngl_ctx *s, const char *path)
+    int ngl_set_tracing(ngl_ctx *s, int nb_events)
+    char *ngl_dump_trace(ngl_ctx *s)
+
+    cdef struct ngl_frame_stats:
+        int nb_draw_calls
+        int nb_dispatch_calls
+        int nb_program_switches
+        int nb_texture_binds
+        int nb_uniform_uploads
+        int nb_buffer_uploads
+        int64_t buffer_upload_bytes
+        int nb_texture_uploads
+        int64_t texture_upload_bytes
+        int64_t readback_bytes
+        int nb_culled_draws
+
+    int ngl_get_frame_stats(ngl_ctx *s, ngl_frame_stats *stats)
     int ngl_set_scene(ngl_ctx *s, ngl_node *scene)
     int ngl_draw(ngl_ctx *s, double t) nogil
     void ngl_free(ngl_ctx **ss)
@@ -74,6 +95,32 @@ cdef class Viewer:
     def configure(self, int platform, int api):
         return ngl_set_glcontext(self.ctx, NULL, NULL, NULL, platform, api)
 
+    def set_update_threads(self, int nb_threads):
+        return ngl_set_update_threads(self.ctx, nb_threads)
+
+    def set_async_prefetch(self, int enable):
+        return ngl_set_async_prefetch(self.ctx, enable)
+
+    def set_program_cache_dir(self, path):
+        if path is None:
+            return ngl_set_program_cache_dir(self.ctx, NULL)
+        return ngl_set_program_cache_dir(self.ctx, path)
+
+    def set_tracing(self, int nb_events):
+        return ngl_set_tracing(self.ctx, nb_events)
+
+    def dump_trace(self):
+        cdef char *s = ngl_dump_trace(self.ctx)
+        if not s:
+            return None
+        return _ret_pystr(s)
+
+    def get_frame_stats(self):
+        cdef ngl_frame_stats stats
+        if ngl_get_frame_stats(self.ctx, &stats) < 0:
+            return None
+        return stats
+
     def set_scene(self, _Node scene):
         return ngl_set_scene(self.ctx, scene.ctx)
 